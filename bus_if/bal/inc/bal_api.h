@@ -128,6 +128,141 @@ void nrf_wifi_bal_write_block(void *ctx,
 		const void *src_addr,
 		size_t len);
 
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+/**
+ * @brief Start reading a block of data from a specific address offset.
+ *
+ * @param ctx Pointer to the context.
+ * @param dest_addr Pointer to the destination address.
+ * @param src_addr_offset Source address offset to read from.
+ * @param len Length of the data to read.
+ *
+ * The destination must not be accessed until nrf_wifi_bal_xfer_wait()
+ * returns. Buses without asynchronous transfers complete the read before
+ * returning.
+ *
+ * @return NRF_WIFI_STATUS_SUCCESS if the read has been started.
+ */
+enum nrf_wifi_status nrf_wifi_bal_read_block_async(void *ctx,
+						   void *dest_addr,
+						   unsigned long src_addr_offset,
+						   size_t len);
+
+/**
+ * @brief Start writing a block of data to a specific address offset.
+ *
+ * @param ctx Pointer to the context.
+ * @param dest_addr_offset Destination address offset to write to.
+ * @param src_addr Pointer to the source address.
+ * @param len Length of the data to write.
+ *
+ * The source must stay valid until nrf_wifi_bal_xfer_wait() returns.
+ *
+ * @return NRF_WIFI_STATUS_SUCCESS if the write has been started.
+ */
+enum nrf_wifi_status nrf_wifi_bal_write_block_async(void *ctx,
+						    unsigned long dest_addr_offset,
+						    const void *src_addr,
+						    size_t len);
+
+/**
+ * @brief Wait for the started block transfers to complete.
+ *
+ * @param ctx Pointer to the context.
+ *
+ * @return NRF_WIFI_STATUS_SUCCESS if all the transfers completed.
+ */
+enum nrf_wifi_status nrf_wifi_bal_xfer_wait(void *ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+#if defined(NRF_WIFI_RX_ZERO_COPY) || defined(__DOXYGEN__)
+/**
+ * @brief Check if the bus can map host RX buffers for writes by the device.
+ *
+ * @param ctx Pointer to the context.
+ *
+ * @return true if nrf_wifi_bal_dma_map_inline_rx() is supported.
+ */
+bool nrf_wifi_bal_inline_rx_supported(void *ctx);
+
+/**
+ * @brief Map a host RX buffer for writes by the device.
+ *
+ * @param ctx Pointer to the context.
+ * @param virt_addr Host address of the buffer.
+ * @param len Length of the buffer.
+ * @param dma_dir DMA direction.
+ *
+ * @return Device address of the mapped buffer, 0 on failure.
+ */
+unsigned long nrf_wifi_bal_dma_map_inline_rx(void *ctx,
+					     unsigned long virt_addr,
+					     size_t len,
+					     enum nrf_wifi_osal_dma_dir dma_dir);
+
+/**
+ * @brief Unmap a host RX buffer mapped using nrf_wifi_bal_dma_map_inline_rx().
+ *
+ * @param ctx Pointer to the context.
+ * @param phy_addr Device address of the buffer.
+ * @param len Length of the buffer.
+ * @param dma_dir DMA direction.
+ *
+ * @return Host address of the buffer if the bus can translate it back,
+ *	   0 otherwise.
+ */
+unsigned long nrf_wifi_bal_dma_unmap_inline_rx(void *ctx,
+					       unsigned long phy_addr,
+					       size_t len,
+					       enum nrf_wifi_osal_dma_dir dma_dir);
+
+/**
+ * @brief Make a host RX buffer which is still mapped visible to the CPU.
+ *
+ * Needs to be called before reading a buffer mapped using
+ * nrf_wifi_bal_dma_map_inline_rx() without unmapping it.
+ *
+ * @param ctx Pointer to the context.
+ * @param phy_addr Device address of the buffer.
+ * @param len Length of the part of the buffer to sync.
+ * @param dma_dir DMA direction.
+ */
+void nrf_wifi_bal_dma_sync_inline_rx(void *ctx,
+				     unsigned long phy_addr,
+				     size_t len,
+				     enum nrf_wifi_osal_dma_dir dma_dir);
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+/**
+ * @brief Add a word write to a transfer queue.
+ *
+ * The write reaches the bus when the queue is flushed, or earlier if the
+ * queue is full.
+ *
+ * @param ctx Pointer to the context.
+ * @param queue Pointer to the transfer queue.
+ * @param addr_offset Address offset.
+ * @param val Value to write.
+ */
+void nrf_wifi_bal_xfer_queue_write(void *ctx,
+				   struct nrf_wifi_bal_xfer_queue *queue,
+				   unsigned long addr_offset,
+				   unsigned int val);
+
+/**
+ * @brief Issue all the writes held in a transfer queue.
+ *
+ * Writes to consecutive addresses are combined into a single bus
+ * transaction if the bus supports it.
+ *
+ * @param ctx Pointer to the context.
+ * @param queue Pointer to the transfer queue.
+ */
+void nrf_wifi_bal_xfer_queue_flush(void *ctx,
+				   struct nrf_wifi_bal_xfer_queue *queue);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
 /**
  * @brief Map a virtual address to a physical address for DMA transfer.
  *
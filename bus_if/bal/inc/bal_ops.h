@@ -12,6 +12,18 @@
 #ifndef __BAL_OPS_H__
 #define __BAL_OPS_H__
 
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+/**
+ * @brief A word write held in a BAL transfer queue.
+ */
+struct nrf_wifi_bal_word_write {
+	/** Address offset. */
+	unsigned long addr_offset;
+	/** Value to write. */
+	unsigned int val;
+};
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
 /**
  * @brief Ops to be provided by a particular bus implementation.
  *
@@ -143,6 +155,112 @@ struct nrf_wifi_bal_ops {
 				   size_t len,
 				   enum nrf_wifi_osal_dma_dir dma_dir);
 
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+	/**
+	 * @brief Start reading a block of data from the bus (optional).
+	 *
+	 * Leave the async Ops as NULL if the bus cannot overlap transfers,
+	 * the BAL then does a synchronous read_block/write_block instead.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param dest_addr Destination address.
+	 * @param src_addr_offset Source address offset.
+	 * @param len Length of the block to read.
+	 * @return Status of the submission.
+	 */
+	enum nrf_wifi_status (*read_block_async)(void *bus_dev_ctx,
+						 void *dest_addr,
+						 unsigned long src_addr_offset,
+						 size_t len);
+
+	/**
+	 * @brief Start writing a block of data to the bus (optional).
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param dest_addr_offset Destination address offset.
+	 * @param src_addr Pointer to the source address.
+	 * @param len Length of the block to write.
+	 * @return Status of the submission.
+	 */
+	enum nrf_wifi_status (*write_block_async)(void *bus_dev_ctx,
+						  unsigned long dest_addr_offset,
+						  const void *src_addr,
+						  size_t len);
+
+	/**
+	 * @brief Wait for all the started block transfers to complete.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @return Status of the transfers.
+	 */
+	enum nrf_wifi_status (*xfer_wait)(void *bus_dev_ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+#if defined(NRF_WIFI_RX_ZERO_COPY) || defined(__DOXYGEN__)
+	/**
+	 * @brief Map a host RX buffer for writes by the device (optional).
+	 *
+	 * Leave the inline RX Ops as NULL if the device cannot write to host
+	 * memory, RX frames are then copied out of the packet RAM.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param virt_addr Host address of the buffer.
+	 * @param len Length of the buffer.
+	 * @param dma_dir DMA direction.
+	 * @return Device address of the mapped buffer, 0 on failure.
+	 */
+	unsigned long (*dma_map_inline_rx)(void *bus_dev_ctx,
+					   unsigned long virt_addr,
+					   size_t len,
+					   enum nrf_wifi_osal_dma_dir dma_dir);
+
+	/**
+	 * @brief Unmap a host RX buffer mapped using dma_map_inline_rx.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param phy_addr Device address of the buffer.
+	 * @param len Length of the buffer.
+	 * @param dma_dir DMA direction.
+	 * @return Host address of the buffer if the bus can translate it back,
+	 *	   0 otherwise.
+	 */
+	unsigned long (*dma_unmap_inline_rx)(void *bus_dev_ctx,
+					     unsigned long phy_addr,
+					     size_t len,
+					     enum nrf_wifi_osal_dma_dir dma_dir);
+
+	/**
+	 * @brief Make a mapped host RX buffer visible to the CPU (optional).
+	 *
+	 * Leave as NULL if the host memory is coherent with the device.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param phy_addr Device address of the buffer.
+	 * @param len Length of the part of the buffer to sync.
+	 * @param dma_dir DMA direction.
+	 */
+	void (*dma_sync_inline_rx)(void *bus_dev_ctx,
+				   unsigned long phy_addr,
+				   size_t len,
+				   enum nrf_wifi_osal_dma_dir dma_dir);
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+	/**
+	 * @brief Write a list of words in as few transactions as possible (optional).
+	 *
+	 * Leave as NULL if the bus cannot combine accesses, the BAL then
+	 * does a write_word for each entry.
+	 *
+	 * @param bus_dev_ctx Pointer to the bus device context.
+	 * @param writes Writes to perform, in order.
+	 * @param num Number of writes.
+	 */
+	void (*write_words)(void *bus_dev_ctx,
+			    const struct nrf_wifi_bal_word_write *writes,
+			    unsigned int num);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
 #if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
 	/**
 	 * @brief Put the device into power-saving sleep mode.
@@ -41,6 +41,24 @@ struct nrf_wifi_bal_priv {
 	enum nrf_wifi_status (*intr_callbk_fn)(void *ctx);
 };
 
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+/** Number of writes a BAL transfer queue holds before it is flushed. */
+#define NRF_WIFI_BAL_XFER_QUEUE_LEN 8
+
+/**
+ * @brief Structure holding word writes to be issued together.
+ *
+ * The queue is owned by the caller and only holds writes. The caller has
+ * to flush it before any access that depends on the queued writes.
+ */
+struct nrf_wifi_bal_xfer_queue {
+	/** Queued writes, in issue order. */
+	struct nrf_wifi_bal_word_write writes[NRF_WIFI_BAL_XFER_QUEUE_LEN];
+	/** Number of queued writes. */
+	unsigned int num_writes;
+};
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
 /**
  * @brief Structure holding the device context for the BAL.
  */
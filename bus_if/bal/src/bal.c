@@ -266,6 +266,209 @@ void nrf_wifi_bal_write_block(void *ctx,
 }
 
 
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+enum nrf_wifi_status nrf_wifi_bal_read_block_async(void *ctx,
+						   void *dest_addr,
+						   unsigned long src_addr_offset,
+						   size_t len)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+#ifdef NRF_WIFI_LOW_POWER
+#ifdef NRF_WIFI_LOW_POWER_DBG
+	nrf_wifi_rpu_bal_sleep_chk(bal_dev_ctx,
+				   src_addr_offset);
+#endif	/* NRF_WIFI_LOW_POWER_DBG */
+#endif  /* NRF_WIFI_LOW_POWER */
+
+	if (!bal_dev_ctx->bpriv->ops->read_block_async) {
+		bal_dev_ctx->bpriv->ops->read_block(bal_dev_ctx->bus_dev_ctx,
+						    dest_addr,
+						    src_addr_offset,
+						    len);
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return bal_dev_ctx->bpriv->ops->read_block_async(bal_dev_ctx->bus_dev_ctx,
+							 dest_addr,
+							 src_addr_offset,
+							 len);
+}
+
+
+enum nrf_wifi_status nrf_wifi_bal_write_block_async(void *ctx,
+						    unsigned long dest_addr_offset,
+						    const void *src_addr,
+						    size_t len)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+#ifdef NRF_WIFI_LOW_POWER
+#ifdef NRF_WIFI_LOW_POWER_DBG
+	nrf_wifi_rpu_bal_sleep_chk(bal_dev_ctx,
+				   dest_addr_offset);
+#endif	/* NRF_WIFI_LOW_POWER_DBG */
+#endif  /* NRF_WIFI_LOW_POWER */
+
+	if (!bal_dev_ctx->bpriv->ops->write_block_async) {
+		bal_dev_ctx->bpriv->ops->write_block(bal_dev_ctx->bus_dev_ctx,
+						     dest_addr_offset,
+						     src_addr,
+						     len);
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return bal_dev_ctx->bpriv->ops->write_block_async(bal_dev_ctx->bus_dev_ctx,
+							  dest_addr_offset,
+							  src_addr,
+							  len);
+}
+
+
+enum nrf_wifi_status nrf_wifi_bal_xfer_wait(void *ctx)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	if (!bal_dev_ctx->bpriv->ops->xfer_wait) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return bal_dev_ctx->bpriv->ops->xfer_wait(bal_dev_ctx->bus_dev_ctx);
+}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+
+#ifdef NRF_WIFI_RX_ZERO_COPY
+bool nrf_wifi_bal_inline_rx_supported(void *ctx)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	return bal_dev_ctx->bpriv->ops->dma_map_inline_rx &&
+		bal_dev_ctx->bpriv->ops->dma_unmap_inline_rx;
+}
+
+
+unsigned long nrf_wifi_bal_dma_map_inline_rx(void *ctx,
+					     unsigned long virt_addr,
+					     size_t len,
+					     enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+	unsigned long phy_addr = 0;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	phy_addr = bal_dev_ctx->bpriv->ops->dma_map_inline_rx(bal_dev_ctx->bus_dev_ctx,
+							      virt_addr,
+							      len,
+							      dma_dir);
+
+	return phy_addr;
+}
+
+
+unsigned long nrf_wifi_bal_dma_unmap_inline_rx(void *ctx,
+					       unsigned long phy_addr,
+					       size_t len,
+					       enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+	unsigned long virt_addr = 0;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	virt_addr = bal_dev_ctx->bpriv->ops->dma_unmap_inline_rx(bal_dev_ctx->bus_dev_ctx,
+								 phy_addr,
+								 len,
+								 dma_dir);
+
+	return virt_addr;
+}
+
+
+void nrf_wifi_bal_dma_sync_inline_rx(void *ctx,
+				     unsigned long phy_addr,
+				     size_t len,
+				     enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	/* Coherent host memory needs no sync */
+	if (!bal_dev_ctx->bpriv->ops->dma_sync_inline_rx) {
+		return;
+	}
+
+	bal_dev_ctx->bpriv->ops->dma_sync_inline_rx(bal_dev_ctx->bus_dev_ctx,
+						    phy_addr,
+						    len,
+						    dma_dir);
+}
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
+
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+void nrf_wifi_bal_xfer_queue_flush(void *ctx,
+				   struct nrf_wifi_bal_xfer_queue *queue)
+{
+	struct nrf_wifi_bal_dev_ctx *bal_dev_ctx = NULL;
+	unsigned int i = 0;
+
+	bal_dev_ctx = (struct nrf_wifi_bal_dev_ctx *)ctx;
+
+	if (!queue->num_writes) {
+		return;
+	}
+
+#ifdef NRF_WIFI_LOW_POWER
+#ifdef NRF_WIFI_LOW_POWER_DBG
+	nrf_wifi_rpu_bal_sleep_chk(bal_dev_ctx,
+				   queue->writes[0].addr_offset);
+#endif	/* NRF_WIFI_LOW_POWER_DBG */
+#endif  /* NRF_WIFI_LOW_POWER */
+
+	if (bal_dev_ctx->bpriv->ops->write_words) {
+		bal_dev_ctx->bpriv->ops->write_words(bal_dev_ctx->bus_dev_ctx,
+						     queue->writes,
+						     queue->num_writes);
+	} else {
+		for (i = 0; i < queue->num_writes; i++) {
+			bal_dev_ctx->bpriv->ops->write_word(bal_dev_ctx->bus_dev_ctx,
+							    queue->writes[i].addr_offset,
+							    queue->writes[i].val);
+		}
+	}
+
+	queue->num_writes = 0;
+}
+
+
+void nrf_wifi_bal_xfer_queue_write(void *ctx,
+				   struct nrf_wifi_bal_xfer_queue *queue,
+				   unsigned long addr_offset,
+				   unsigned int val)
+{
+	if (queue->num_writes == NRF_WIFI_BAL_XFER_QUEUE_LEN) {
+		nrf_wifi_bal_xfer_queue_flush(ctx,
+					      queue);
+	}
+
+	queue->writes[queue->num_writes].addr_offset = addr_offset;
+	queue->writes[queue->num_writes].val = val;
+	queue->num_writes++;
+}
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
+
 unsigned long nrf_wifi_bal_dma_map(void *ctx,
 				   unsigned long virt_addr,
 				   size_t len,
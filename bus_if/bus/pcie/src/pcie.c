@@ -293,6 +293,86 @@ void nrf_wifi_bus_pcie_write_block(void *dev_ctx,
 		src_addr,
 		len);
 }
+
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+enum nrf_wifi_status nrf_wifi_bus_pcie_read_block_async(void *dev_ctx,
+														void *dest_addr,
+														unsigned long src_addr_offset,
+														size_t len)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	void *mmap_addr = NULL;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	mmap_addr = pcie_dev_ctx->iomem_addr_base + src_addr_offset;
+
+	status = nrf_wifi_osal_bus_pcie_dev_dma_xfer(
+		pcie_dev_ctx->os_pcie_dev_ctx,
+		dest_addr,
+		mmap_addr,
+		len,
+		NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+
+	/* No DMA engine for the device, fall back to a memory mapped copy */
+	if (status != NRF_WIFI_STATUS_SUCCESS)
+	{
+		nrf_wifi_osal_iomem_cpy_from(
+			dest_addr,
+			mmap_addr,
+			len);
+
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return status;
+}
+
+enum nrf_wifi_status nrf_wifi_bus_pcie_write_block_async(void *dev_ctx,
+														 unsigned long dest_addr_offset,
+														 const void *src_addr,
+														 size_t len)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	void *mmap_addr = NULL;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	mmap_addr = pcie_dev_ctx->iomem_addr_base + dest_addr_offset;
+
+	status = nrf_wifi_osal_bus_pcie_dev_dma_xfer(
+		pcie_dev_ctx->os_pcie_dev_ctx,
+		(void *)src_addr,
+		mmap_addr,
+		len,
+		NRF_WIFI_OSAL_DMA_DIR_TO_DEV);
+
+	/* No DMA engine for the device, fall back to a memory mapped copy */
+	if (status != NRF_WIFI_STATUS_SUCCESS)
+	{
+		nrf_wifi_osal_iomem_cpy_to(
+			mmap_addr,
+			src_addr,
+			len);
+
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return status;
+}
+
+enum nrf_wifi_status nrf_wifi_bus_pcie_xfer_wait(void *dev_ctx)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	return nrf_wifi_osal_bus_pcie_dev_dma_xfer_wait(
+		pcie_dev_ctx->os_pcie_dev_ctx);
+}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
 #ifdef SOC_WEZEN
 #ifdef INLINE_RX
 unsigned long nrf_wifi_bus_pcie_dma_map_inline_rx(void *dev_ctx,
@@ -320,6 +400,61 @@ unsigned long nrf_wifi_bus_pcie_dma_unmap_inline_rx(void *dev_ctx,
 }
 #endif
 #endif
+#if defined(NRF_WIFI_RX_ZERO_COPY) && !(defined(SOC_WEZEN) && defined(INLINE_RX))
+/* RX buffers can be anywhere in host memory, have the OS map them */
+unsigned long nrf_wifi_bus_pcie_dma_map_inline_rx(void *dev_ctx,
+												  unsigned long virt_addr,
+												  size_t len,
+												  enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+	unsigned long phy_addr = 0;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	phy_addr = (unsigned long)nrf_wifi_osal_bus_pcie_dev_dma_map(
+		pcie_dev_ctx->os_pcie_dev_ctx,
+		(void *)virt_addr,
+		len,
+		dma_dir);
+
+	return phy_addr;
+}
+
+unsigned long nrf_wifi_bus_pcie_dma_unmap_inline_rx(void *dev_ctx,
+													unsigned long phy_addr,
+													size_t len,
+													enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	nrf_wifi_osal_bus_pcie_dev_dma_unmap(
+		pcie_dev_ctx->os_pcie_dev_ctx,
+		(void *)phy_addr,
+		len,
+		dma_dir);
+
+	/* The OS mapping cannot be translated back */
+	return 0;
+}
+
+static void nrf_wifi_bus_pcie_dma_sync_inline_rx(void *dev_ctx,
+						 unsigned long phy_addr,
+						 size_t len,
+						 enum nrf_wifi_osal_dma_dir dma_dir)
+{
+	struct nrf_wifi_bus_pcie_dev_ctx *pcie_dev_ctx = NULL;
+
+	pcie_dev_ctx = (struct nrf_wifi_bus_pcie_dev_ctx *)dev_ctx;
+
+	nrf_wifi_osal_bus_pcie_dev_dma_sync_for_cpu(pcie_dev_ctx->os_pcie_dev_ctx,
+						    (void *)phy_addr,
+						    len,
+						    dma_dir);
+}
+#endif /* NRF_WIFI_RX_ZERO_COPY && !(SOC_WEZEN && INLINE_RX) */
 
 unsigned long nrf_wifi_bus_pcie_dma_map(void *dev_ctx,
 										unsigned long virt_addr,
@@ -447,12 +582,18 @@ struct nrf_wifi_bal_ops nrf_wifi_bus_pcie_ops = {
 	.write_block = &nrf_wifi_bus_pcie_write_block,
 	.dma_map = &nrf_wifi_bus_pcie_dma_map,
 	.dma_unmap = &nrf_wifi_bus_pcie_dma_unmap,
-#ifdef SOC_WEZEN
-#ifdef INLINE_RX
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+	.read_block_async = &nrf_wifi_bus_pcie_read_block_async,
+	.write_block_async = &nrf_wifi_bus_pcie_write_block_async,
+	.xfer_wait = &nrf_wifi_bus_pcie_xfer_wait,
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+#ifdef NRF_WIFI_RX_ZERO_COPY
 	.dma_map_inline_rx = &nrf_wifi_bus_pcie_dma_map_inline_rx,
 	.dma_unmap_inline_rx = &nrf_wifi_bus_pcie_dma_unmap_inline_rx,
-#endif
-#endif
+#if !(defined(SOC_WEZEN) && defined(INLINE_RX))
+	.dma_sync_inline_rx = &nrf_wifi_bus_pcie_dma_sync_inline_rx,
+#endif /* !(SOC_WEZEN && INLINE_RX) */
+#endif /* NRF_WIFI_RX_ZERO_COPY */
 #ifdef NRF_WIFI_LOW_POWER
 	.rpu_ps_sleep = &nrf_wifi_bus_pcie_rpu_ps_sleep,
 	.rpu_ps_wake = &nrf_wifi_bus_pcie_rpu_ps_wake,
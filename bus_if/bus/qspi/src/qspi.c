@@ -275,6 +275,51 @@ static unsigned long nrf_wifi_bus_qspi_dma_unmap(void *dev_ctx,
 }
 
 
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+static void nrf_wifi_bus_qspi_write_words(void *dev_ctx,
+					  const struct nrf_wifi_bal_word_write *writes,
+					  unsigned int num)
+{
+	struct nrf_wifi_bus_qspi_dev_ctx *qspi_dev_ctx = NULL;
+	unsigned int vals[NRF_WIFI_BAL_XFER_QUEUE_LEN];
+	unsigned int i = 0;
+	unsigned int j = 0;
+	unsigned int k = 0;
+
+	qspi_dev_ctx = (struct nrf_wifi_bus_qspi_dev_ctx *)dev_ctx;
+
+	while (i < num) {
+		/* Writes to consecutive words go out as a single burst, saving
+		 * the chip select and command overhead of each one.
+		 */
+		for (j = i + 1; (j < num) && ((j - i) < NRF_WIFI_BAL_XFER_QUEUE_LEN); j++) {
+			if (writes[j].addr_offset !=
+			    (writes[j - 1].addr_offset + sizeof(vals[0]))) {
+				break;
+			}
+		}
+
+		if ((j - i) == 1) {
+			nrf_wifi_osal_qspi_write_reg32(qspi_dev_ctx->os_qspi_dev_ctx,
+						       qspi_dev_ctx->host_addr_base + writes[i].addr_offset,
+						       writes[i].val);
+		} else {
+			for (k = i; k < j; k++) {
+				vals[k - i] = writes[k].val;
+			}
+
+			nrf_wifi_osal_qspi_cpy_to(qspi_dev_ctx->os_qspi_dev_ctx,
+						  qspi_dev_ctx->host_addr_base + writes[i].addr_offset,
+						  vals,
+						  (j - i) * sizeof(vals[0]));
+		}
+
+		i = j;
+	}
+}
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
+
+
 #ifdef NRF_WIFI_LOW_POWER
 static void nrf_wifi_bus_qspi_ps_sleep(void *dev_ctx)
 {
@@ -320,6 +365,9 @@ static struct nrf_wifi_bal_ops nrf_wifi_bus_qspi_ops = {
 	.write_block = &nrf_wifi_bus_qspi_write_block,
 	.dma_map = &nrf_wifi_bus_qspi_dma_map,
 	.dma_unmap = &nrf_wifi_bus_qspi_dma_unmap,
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+	.write_words = &nrf_wifi_bus_qspi_write_words,
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 #ifdef NRF_WIFI_LOW_POWER
 	.rpu_ps_sleep = &nrf_wifi_bus_qspi_ps_sleep,
 	.rpu_ps_wake = &nrf_wifi_bus_qspi_ps_wake,
@@ -260,6 +260,57 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_get_power_save_info(void *fmac_dev_ctx,
  */
 enum nrf_wifi_status nrf_wifi_fmac_stats_reset(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
 
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+/**
+ * @brief Get the statistics of the queue of commands waiting to be posted to the RPU.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the statistics, except the current depth, after copying them.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_cmd_q_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						   struct nrf_wifi_hal_cmd_q_stats *stats,
+						   bool reset);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+#if defined(NRF_WIFI_HAL_EVENT_REASM_BUF) || defined(__DOXYGEN__)
+/**
+ * @brief Get the statistics of the events read from the RPU.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the statistics after copying them.
+ *
+ * The statistics cover the fragment counts and reassembly latency of
+ * fragmented events, and the events which did not fit in the preallocated
+ * reassembly buffer or were dropped for lack of memory.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_hal_event_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						       struct nrf_wifi_hal_event_stats *stats,
+						       bool reset);
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+#if (defined(NRF_WIFI_HAL_BUS_SELFTEST) && !defined(NRF71_ON_IPC)) || defined(__DOXYGEN__)
+/**
+ * @brief Measure the throughput and latency of the bus to the RPU.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param num_iters Number of reads and of writes to time for each access size.
+ * @param result Pointer to the results to be filled.
+ *
+ * Block and word accesses of several sizes are timed against scratch
+ * regions of the packet RAM and the global RAM. This has to be done before
+ * the firmware is loaded, since the RPU must not use the scratch regions
+ * during the test, and fails once the firmware has booted.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_bus_selftest(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						unsigned int num_iters,
+						struct nrf_wifi_hal_bus_selftest *result);
+#endif /* NRF_WIFI_HAL_BUS_SELFTEST && !NRF71_ON_IPC */
+
 /**
  * @}
  */
@@ -26,6 +26,18 @@ enum nrf_wifi_status umac_cmd_cfg(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				  void *params,
 				  int len);
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+/* Like umac_cmd_cfg, but does not wait for the RPU to take the command,
+ * callbk_fn reports whether it was posted or dropped.
+ */
+enum nrf_wifi_status umac_cmd_cfg_async(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					void *params,
+					int len,
+					void (*callbk_fn)(void *callbk_data,
+							  enum nrf_wifi_status status),
+					void *callbk_data);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
 enum nrf_wifi_status umac_cmd_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
 
 enum nrf_wifi_status umac_cmd_srcoex(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
@@ -26,6 +26,11 @@
 #define NRF_WIFI_FMAC_FTYPE_DATA 0x0008
 #define NRF_WIFI_FMAC_STYPE_DATA 0x0000
 #define NRF_WIFI_FMAC_STYPE_QOS_DATA 0x0080
+#define NRF_WIFI_FMAC_FTYPE_MGMT 0x0000
+#define NRF_WIFI_FMAC_STYPE_DEAUTH 0x00C0
+
+#define NRF_WIFI_FMAC_MGMT_HDR_LEN 24
+#define NRF_WIFI_FMAC_REASON_UNSPECIFIED 1
 
 #define NRF_WIFI_FMAC_FCTL_FTYPE 0x000c
 #define NRF_WIFI_FMAC_FCTL_PROTECTED 0x4000
@@ -68,7 +73,16 @@
 #define NRF_WIFI_FMAC_MPLS_LS_TC_SHIFT 0x09
 #define NRF_WIFI_FMAC_IPV6_TOS_MASK 0x0FF0
 #define NRF_WIFI_FMAC_IPV6_TOS_SHIFT 0x04 /* 4bit */
+#define NRF_WIFI_FMAC_IPV4_HDR_MIN_LEN 20
+#define NRF_WIFI_FMAC_IP_ECN_MASK 0x03
+#define NRF_WIFI_FMAC_IP_ECN_NOT_ECT 0x00
+#define NRF_WIFI_FMAC_IP_ECN_CE 0x03
 #define NRF_WIFI_FMAC_ETH_TYPE_MASK 0xFFFF
+#define NRF_WIFI_FMAC_IP_PROTO_TCP 6
+#define NRF_WIFI_FMAC_TCP_HDR_MIN_LEN 20
+#define NRF_WIFI_FMAC_TCP_FLAG_FIN 0x01
+#define NRF_WIFI_FMAC_TCP_FLAG_PSH 0x08
+#define NRF_WIFI_FMAC_TCP_FLAG_CWR 0x80
 
 struct nrf_wifi_fmac_ieee80211_hdr {
 	unsigned short fc;
@@ -122,6 +122,60 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_start(struct nrf_wifi_fmac_dev_ctx
  */
 enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_stop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
 
+#if defined(NRF_WIFI_OFF_RAW_TX_TMPL_BANK) || defined(__DOXYGEN__)
+/**
+ * @brief Preload an offloaded raw TX frame template into the RPU.
+ * @param fmac_dev_ctx Pointer to the context of the RPU instance.
+ * @param idx Index of the template slot (0 to NRF_WIFI_OFF_RAW_TX_TMPL_MAX - 1).
+ * @param off_ctrl_params Offloaded raw tx control information of the template.
+ * @param off_tx_params Offloaded raw tx parameters of the template.
+ * @param pkt Frame payload, off_tx_params->pkt_length bytes.
+ *
+ * This function writes the frame payload to the template slot in the RPU
+ *	    packet RAM and stores the parameters on the host. Nothing is sent
+ *	    to the firmware until the template is selected using
+ *	    nrf_wifi_off_raw_tx_fmac_tmpl_switch(). The active template cannot
+ *	    be reloaded, load an inactive slot and switch to it instead.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS On Success
+ * @retval NRF_WIFI_STATUS_FAIL On failure to execute command
+ */
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_load(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							unsigned char idx,
+							struct nrf_wifi_offload_ctrl_params *off_ctrl_params,
+							struct nrf_wifi_offload_tx_ctrl *off_tx_params,
+							const void *pkt);
+
+/**
+ * @brief Switch the offloaded raw TX to a preloaded frame template.
+ * @param fmac_dev_ctx Pointer to the context of the RPU instance.
+ * @param idx Index of a previously loaded template.
+ *
+ * This function points the offloaded raw TX at a preloaded template. Only
+ *	    the parameters are sent to the RPU, the payload is not resent and
+ *	    the stream is not stopped and restarted. Switching to the already
+ *	    active template is a no-op.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS On Success
+ * @retval NRF_WIFI_STATUS_FAIL On failure to execute command
+ */
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_switch(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							  unsigned char idx);
+
+/**
+ * @brief Get the offloaded raw TX template bank statistics.
+ * @param fmac_dev_ctx Pointer to the context of the RPU instance.
+ * @param stats Pointer to memory where the stats are to be copied.
+ * @param reset Reset the stats after copying them.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS On Success
+ * @retval NRF_WIFI_STATUS_FAIL On failure to execute command
+ */
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							     struct nrf_wifi_off_raw_tx_tmpl_stats *stats,
+							     bool reset);
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
+
 /**
  * @brief Get the RF parameters to be programmed to the RPU.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -26,6 +26,43 @@
 #include "common/fmac_structs_common.h"
 #define NRF_WIFI_FMAC_PARAMS_RECV_TIMEOUT 100 /* ms */
 
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+/** Number of frame templates that can be preloaded into the RPU. */
+#define NRF_WIFI_OFF_RAW_TX_TMPL_MAX 8
+/** Size of a template slot in the RPU packet RAM (max frame length). */
+#define NRF_WIFI_OFF_RAW_TX_TMPL_SLOT_LEN 600
+/** Index used to indicate that no template is active. */
+#define NRF_WIFI_OFF_RAW_TX_TMPL_NONE 0xFF
+
+/**
+ * @brief Structure to hold a preloaded offloaded raw TX frame template.
+ *
+ * The payload lives in a fixed slot of the RPU packet RAM, only the
+ * parameters are kept on the host so that a switch does not need to
+ * resend the frame.
+ */
+struct nrf_wifi_off_raw_tx_tmpl {
+	/** Control parameters (period, TX power, channel) of the template. */
+	struct nrf_wifi_offload_ctrl_params ctrl_params;
+	/** TX parameters of the template, pkt_ram_ptr points to its slot. */
+	struct nrf_wifi_offload_tx_ctrl tx_params;
+	/** Set once the template payload has been loaded. */
+	bool valid;
+};
+
+/**
+ * @brief Structure to hold the template bank statistics.
+ */
+struct nrf_wifi_off_raw_tx_tmpl_stats {
+	/** Number of template payloads written to the RPU. */
+	unsigned int num_loads;
+	/** Number of switches that were sent to the RPU. */
+	unsigned int num_switches;
+	/** Number of switches to the already active template. */
+	unsigned int num_switches_skipped;
+};
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
+
 /**
  * @brief  Structure to hold per device context information for the UMAC IF layer.
  *
@@ -35,6 +72,11 @@
 struct nrf_wifi_off_raw_tx_fmac_dev_ctx {
     enum nrf_wifi_cmd_status off_raw_tx_cmd_status;
     bool off_raw_tx_cmd_done;
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+    struct nrf_wifi_off_raw_tx_tmpl tmpl[NRF_WIFI_OFF_RAW_TX_TMPL_MAX];
+    unsigned char tmpl_active;
+    struct nrf_wifi_off_raw_tx_tmpl_stats tmpl_stats;
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
 };
 
 
@@ -304,6 +304,33 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_stats_get(struct nrf_wifi_fmac_dev_ctx *fm
 						enum rpu_op_mode op_mode,
 						struct rpu_rt_op_stats *stats);
 
+#if defined(NRF_WIFI_RT_SWEEP) || defined(__DOXYGEN__)
+/**
+ * @brief Execute a list of radio test steps back to back.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param steps List of steps to execute in order.
+ * @param num_steps Number of entries in @p steps.
+ * @param results Buffer with @p num_steps entries where the per step
+ *		  results are collected.
+ * @param stop_on_err Stop the sweep at the first failing step.
+ *
+ * This function runs a complete channel/rate/power sweep in a single call.
+ *	    Each step is issued as soon as the previous one has been acknowledged
+ *	    by the RPU and completion is polled every NRF_WIFI_RT_SWEEP_POLL_MS
+ *	    so that the host turnaround between steps stays small. Measurement
+ *	    values (RSSI, temperature, battery voltage, XO) are returned in
+ *	    @p results instead of only being logged.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS All steps succeeded
+ * @retval NRF_WIFI_STATUS_FAIL Invalid parameters or at least one step failed
+ */
+enum nrf_wifi_status nrf_wifi_rt_fmac_sweep(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					    const struct nrf_wifi_rt_sweep_step *steps,
+					    unsigned int num_steps,
+					    struct nrf_wifi_rt_sweep_result *results,
+					    bool stop_on_err);
+#endif /* NRF_WIFI_RT_SWEEP */
+
 /**
  * @}
  */
@@ -29,6 +29,69 @@
 
 #include "common/fmac_structs_common.h"
 
+#ifdef NRF_WIFI_RT_SWEEP
+/** Poll interval used while waiting for a sweep step to complete. */
+#define NRF_WIFI_RT_SWEEP_POLL_MS 1
+
+/**
+ * @brief The operations that can be executed as a step of a radio test sweep.
+ */
+enum nrf_wifi_rt_sweep_op {
+	/** Program radio test TX using @p conf of the step. */
+	NRF_WIFI_RT_SWEEP_OP_PROG_TX,
+	/** Program radio test RX using @p conf of the step. */
+	NRF_WIFI_RT_SWEEP_OP_PROG_RX,
+	/** Start/stop a TX tone (@p enable, @p tone_freq, @p tx_power). */
+	NRF_WIFI_RT_SWEEP_OP_TX_TONE,
+	/** Enable/disable DPD (@p enable). */
+	NRF_WIFI_RT_SWEEP_OP_DPD,
+	/** Read the RF RSSI, result is the AGC status value. */
+	NRF_WIFI_RT_SWEEP_OP_RF_RSSI,
+	/** Read the temperature, result is in degree celsius. */
+	NRF_WIFI_RT_SWEEP_OP_TEMP,
+	/** Read the battery voltage, result is in mV. */
+	NRF_WIFI_RT_SWEEP_OP_BAT_VOLT,
+	/** Set the XO value (@p xo_val), result is the configured value. */
+	NRF_WIFI_RT_SWEEP_OP_SET_XO,
+	/** Compute the best XO value, result is the computed value. */
+	NRF_WIFI_RT_SWEEP_OP_COMPUTE_XO,
+	/** Do nothing, only wait for @p dwell_ms. */
+	NRF_WIFI_RT_SWEEP_OP_DWELL,
+};
+
+/**
+ * @brief Structure describing a single step of a radio test sweep.
+ */
+struct nrf_wifi_rt_sweep_step {
+	/** Operation to execute, see &enum nrf_wifi_rt_sweep_op. */
+	enum nrf_wifi_rt_sweep_op op;
+	/** Channel/rate/power configuration for the PROG_TX/PROG_RX operations. */
+	struct rpu_conf_params *conf;
+	/** Enable flag for the TX_TONE/DPD operations. */
+	unsigned char enable;
+	/** Tone frequency for the TX_TONE operation. */
+	signed char tone_freq;
+	/** TX power for the TX_TONE operation. */
+	signed char tx_power;
+	/** XO value for the SET_XO operation. */
+	unsigned char xo_val;
+	/** Time to wait after the step has completed, in ms. */
+	unsigned int dwell_ms;
+};
+
+/**
+ * @brief Structure holding the result of a single step of a radio test sweep.
+ */
+struct nrf_wifi_rt_sweep_result {
+	/** Completion status of the step. */
+	enum nrf_wifi_status status;
+	/** Value reported by the RPU for the measurement operations. */
+	int value;
+	/** Time taken by the step excluding the dwell time, in us. */
+	unsigned int duration_us;
+};
+#endif /* NRF_WIFI_RT_SWEEP */
+
 /**
  * @brief  Structure to hold per device context information for the UMAC IF layer.
  *
@@ -48,6 +111,12 @@ struct nrf_wifi_rt_fmac_dev_ctx {
 	enum nrf_wifi_cmd_status radio_cmd_status;
 	/** Firmware RF test RX capture event status */
 	unsigned char capture_status;
+#ifdef NRF_WIFI_RT_SWEEP
+	/** Value reported by the last RF test measurement event. */
+	int rf_test_val;
+	/** Set when @p rf_test_val holds a valid measurement. */
+	bool rf_test_val_valid;
+#endif /* NRF_WIFI_RT_SWEEP */
 };
 
 
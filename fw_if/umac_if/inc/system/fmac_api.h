@@ -84,6 +84,10 @@ struct nrf_wifi_fmac_priv *nrf_wifi_sys_fmac_init(struct nrf_wifi_data_config_pa
  *          the regulatory restrictions to be taken care by the invoker of the
  *          API.
  *
+ *	    With NRF_WIFI_HAL_ASYNC_CMD the command is only queued, and a scan
+ *	    which cannot be posted to the RPU is reported through
+ *	    scan_abort_callbk_fn.
+ *
  *@retval	NRF_WIFI_STATUS_SUCCESS On success
  *@retval	NRF_WIFI_STATUS_FAIL On failure to execute command
  */
@@ -218,6 +222,9 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_disassoc(void *fmac_dev_ctx,
  *	      The key is for the peer identified by \p mac_addr on the
  *	      interface identified with \p if_idx.
  *
+ *	    With NRF_WIFI_HAL_ASYNC_CMD the command is only queued, ahead of
+ *	    any later command, and a failure to post it is logged.
+ *
  *@retval	NRF_WIFI_STATUS_SUCCESS On success
  *@retval	NRF_WIFI_STATUS_FAIL On failure to execute command
  */
@@ -619,6 +626,37 @@ enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *fmac_dev_ctx,
 					      unsigned char if_idx,
 					      void *netbuf);
 
+#if defined(NRF70_TX_SEG_OFFLOAD) || defined(__DOXYGEN__)
+/**
+ * @brief Segment a large TCP frame and transmit the segments to the RPU.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface on which the frame is to be
+ *               transmitted.
+ * @param netbuf Pointer to the OS specific network buffer holding an
+ *               Ethernet/IPv4/TCP header template followed by the payload.
+ * @param mss Maximum TCP payload size of each segment.
+ *
+ * This function splits the payload into @p mss sized segments, each carrying
+ * a copy of the header template with the IP length, IP ID, IP header
+ * checksum and TCP sequence number adjusted. The segments are queued under a
+ * single TX lock hold and handed over to the RPU using all the descriptors
+ * available so that the aggregates are filled. The TCP checksums of the
+ * segments are filled in by the RPU, so this needs
+ * NRF70_TCP_IP_CHECKSUM_OFFLOAD.
+ *
+ * The segments are only queued if the pending queue has room for all of
+ * them. Frames that are not TCP/IPv4 or whose payload fits in @p mss are sent
+ * using nrf_wifi_fmac_start_xmit(). @p netbuf is consumed in all cases.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL If not all of the segments could be queued
+ */
+enum nrf_wifi_status nrf_wifi_fmac_start_xmit_seg(void *fmac_dev_ctx,
+						  unsigned char if_idx,
+						  void *netbuf,
+						  unsigned short mss);
+#endif /* NRF70_TX_SEG_OFFLOAD */
+
 /**
  * @brief Inform the RPU firmware that host is going to suspend state.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -1032,6 +1070,55 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_ps_exit_strategy(
 enum nrf_wifi_status nrf_wifi_fmac_start_rawpkt_xmit(void *dev_ctx,
 						     unsigned char if_idx,
 						     void *net_packet);
+
+#if defined(NRF70_RAW_TX_BATCH) || defined(__DOXYGEN__)
+/**
+ * @brief Transmit a batch of raw frames sharing the same raw TX header.
+ * @param dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface on which the frames are to be
+ *               transmitted.
+ * @param net_packets Array of OS specific network buffers, without a raw
+ *                    TX header and with enough headroom to prepend one.
+ * @param num_packets Number of network buffers in @p net_packets.
+ * @param raw_tx_hdr Raw TX header applied to all the frames, filled as for
+ *                   nrf_wifi_fmac_start_rawpkt_xmit().
+ * @param cookie Caller context passed to raw_tx_batch_done_callbk_fn.
+ *
+ * This function queues all the frames under a single acquisition of the
+ * TX lock and then hands them over to the RPU using as many TX descriptors
+ * as are available, instead of going through the descriptor acquisition
+ * once per frame. Where the RPU supports several raw frames per command,
+ * the frames of a batch are also packed in as few commands as the
+ * aggregation and max_ampdu_len_per_token limits allow.
+ *
+ * raw_tx_batch_done_callbk_fn is called once all the frames of the batch
+ * have been completed, with the number of frames which failed. The network
+ * buffers are owned by the driver once this function is called, whatever
+ * the outcome.
+ *
+ *@retval      NRF_WIFI_STATUS_SUCCESS At least one frame was queued
+ *@retval      NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_fmac_start_rawpkt_xmit_batch(void *dev_ctx,
+							   unsigned char if_idx,
+							   void **net_packets,
+							   unsigned int num_packets,
+							   struct raw_tx_pkt_header *raw_tx_hdr,
+							   void *cookie);
+
+/**
+ * @brief Get the raw TX batching statistics.
+ * @param dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the counters after copying them.
+ *
+ *@retval      NRF_WIFI_STATUS_SUCCESS On success
+ *@retval      NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_fmac_raw_tx_batch_stats_get(void *dev_ctx,
+							  struct nrf_wifi_fmac_raw_tx_batch_stats *stats,
+							  bool reset);
+#endif /* NRF70_RAW_TX_BATCH */
 #endif /* NRF70_RAW_DATA_TX */
 
 /**
@@ -1181,6 +1268,221 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_conf_ltf_gi(struct nrf_wifi_fmac_dev_ctx
 enum nrf_wifi_status nrf_wifi_sys_fmac_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						 enum rpu_stats_type stats_type,
 						 struct rpu_sys_op_stats *stats);
+
+#if defined(NRF70_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the host side TX latency histograms.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to memory where the histograms are to be copied.
+ * @param reset Clear the histograms after copying them.
+ *
+ * This function returns the per access category histograms of the time
+ *	    frames spend in the driver pending queues, the time from posting
+ *	    the TX command to the TX done event and the PHY TX to ACK time
+ *	    reported in the TX done event.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_lat_stats_get(void *fmac_dev_ctx,
+							struct nrf_wifi_tx_lat_stats *stats,
+							bool reset);
+#endif /* NRF70_TX_LATENCY_STATS */
+
+#if defined(NRF70_TX_AQM) || defined(__DOXYGEN__)
+/**
+ * @brief Get the AQM statistics of a pending TX queue.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param peer_id Peer index of the queue (MAX_PEERS for the raw/multicast queue).
+ * @param ac Access category of the queue.
+ * @param stats Pointer to memory where the statistics are to be copied.
+ * @param reset Clear the statistics after copying them.
+ *
+ * This function returns the number of frames dropped or ECN marked by the
+ *	    CoDel AQM, the number of frames dropped because the queue was full
+ *	    and the largest sojourn time seen for the queue.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_aqm_stats_get(void *fmac_dev_ctx,
+							unsigned int peer_id,
+							unsigned int ac,
+							struct nrf_wifi_tx_aqm_stats *stats,
+							bool reset);
+#endif /* NRF70_TX_AQM */
+
+#if defined(NRF70_RX_BUF_RECYCLE) || defined(__DOXYGEN__)
+/**
+ * @brief Return a RX buffer to the driver for reuse.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param nwb RX buffer handed to the upper layer by the driver, which the
+ *	      upper layer is done with.
+ *
+ * This function is to be called by the upper layer instead of freeing a
+ *	    RX buffer. The buffer is kept in the free list of the RX buffer
+ *	    pool it fits and is used for the next RX refill of that pool. If
+ *	    the free list is full the buffer is freed. The buffer is consumed
+ *	    in all cases except invalid parameters.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_rx_buf_recycle(void *fmac_dev_ctx,
+						      void *nwb);
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+/**
+ * @brief Register a handler for a UMAC event.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param event_num UMAC event ID (one of NRF_WIFI_UMAC_EVENT_*).
+ * @param handler Handler to be invoked for the event, NULL to restore the
+ *		  built-in handling.
+ * @param min_len Minimum length of the event, shorter events are dropped
+ *		  without invoking the handler.
+ *
+ * This function overrides the built-in handling of a UMAC event for the
+ *	    device. It should be called before the device starts generating
+ *	    the event, since it is not synchronized with event processing.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_event_handler_register(void *fmac_dev_ctx,
+							      unsigned int event_num,
+							      nrf_wifi_umac_event_handler_t handler,
+							      unsigned int min_len);
+
+/**
+ * @brief Get the processing statistics of a UMAC event.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param event_num UMAC event ID (one of NRF_WIFI_UMAC_EVENT_*).
+ * @param stats Pointer to memory where the statistics are to be copied.
+ * @param reset Clear the statistics after copying them.
+ *
+ * This function returns the number of times the event was received, the
+ *	    number of times it was dropped or failed and the time spent in
+ *	    its handler.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_event_stats_get(void *fmac_dev_ctx,
+						       unsigned int event_num,
+						       struct nrf_wifi_umac_event_stats *stats,
+						       bool reset);
+
+#if defined(NRF_WIFI_RPU_RECOVERY_TELEMETRY) || defined(__DOXYGEN__)
+/**
+ * @brief Get the RPU watchdog and recovery telemetry.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param telemetry Pointer to the telemetry to be filled.
+ * @param reset Clear the watchdog events and recovery durations after
+ *		copying them.
+ *
+ * This function returns the host state (time since the last RPU sleep
+ *	    opportunity, PS state, pending commands and outstanding TX buffers)
+ *	    captured for the last watchdog interrupts along with the decision
+ *	    taken for each of them, and the durations of the recoveries which
+ *	    completed through nrf_wifi_sys_fmac_fast_recovery. Full recoveries
+ *	    remove the device and are not accounted, so the recovery durations
+ *	    stay zero without NRF_WIFI_RPU_FAST_RECOVERY.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_telemetry_get(void *fmac_dev_ctx,
+								  struct nrf_wifi_hal_rpu_recovery_telemetry *telemetry,
+								  bool reset);
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+#if defined(NRF70_RAW_RX_BATCH) || defined(__DOXYGEN__)
+/**
+ * @brief Get the raw RX batching statistics.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the counters after copying them.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_raw_rx_batch_stats_get(void *fmac_dev_ctx,
+							      struct nrf_wifi_fmac_raw_rx_batch_stats *stats,
+							      bool reset);
+#endif /* NRF70_RAW_RX_BATCH */
+
+#if defined(NRF_WIFI_SCAN_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Get the BSSs held in the scan result cache.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param entries Array to be filled with the cached BSSs.
+ * @param max_entries Number of elements in @p entries.
+ * @param num_entries Number of BSSs copied to @p entries.
+ *
+ * This function copies the BSSs reported by the scans done so far, one
+ *	    entry per BSSID, without a round-trip to the RPU. BSSs which were
+ *	    not reported for NRF_WIFI_FMAC_BSS_CACHE_AGE_MS are dropped.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_get(void *fmac_dev_ctx,
+						     struct nrf_wifi_fmac_bss_cache_entry *entries,
+						     unsigned int max_entries,
+						     unsigned int *num_entries);
+
+/**
+ * @brief Drop all the BSSs held in the scan result cache.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_flush(void *fmac_dev_ctx);
+
+/**
+ * @brief Get the scan result cache statistics.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the counters after copying them.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_stats_get(void *fmac_dev_ctx,
+							   struct nrf_wifi_fmac_bss_cache_stats *stats,
+							   bool reset);
+#endif /* NRF_WIFI_SCAN_CACHE */
+
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+/**
+ * @brief Recover the RPU without tearing down the device.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param fw_info Firmware patches to be loaded to the RPU, these are the
+ *		  same as the ones passed to nrf_wifi_fmac_fw_load.
+ *
+ * This function reloads and reboots the RPU and replays the VIF, MAC
+ *	    address and interface state configuration to it. The RX buffer
+ *	    pool configuration is kept, and group and raw TX frames which were
+ *	    handed to the RPU but not completed are requeued instead of being
+ *	    dropped. Connections are not restored: in-flight unicast TX frames
+ *	    are dropped, the peers are flushed and a deauthentication from
+ *	    each of them is reported through deauth_callbk_fn, so that the
+ *	    upper layers reconnect and install new keys.
+ *
+ *	    It sleeps, so it should be called from the OS recovery work in
+ *	    place of removing and adding the device, and not from
+ *	    the rpu_recovery_callbk_fn callback. If it fails, the TX path is
+ *	    unblocked and rpu_recovery_callbk_fn is invoked again, the OS
+ *	    should then remove and add the device instead of retrying.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_fast_recovery(void *fmac_dev_ctx,
+						     struct nrf_wifi_fmac_fw_info *fw_info);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 /**
  * @brief Send  Rx buffer details to firmware.
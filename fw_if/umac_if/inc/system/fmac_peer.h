@@ -30,4 +30,8 @@ void nrf_wifi_fmac_peer_remove(struct nrf_wifi_fmac_dev_ctx *fmac_ctx,
 void nrf_wifi_fmac_peers_flush(struct nrf_wifi_fmac_dev_ctx *fmac_ctx,
 			       unsigned char if_idx);
 
+#ifdef NRF70_TX_FLOW_CACHE
+void nrf_wifi_fmac_tx_flow_cache_flush(struct nrf_wifi_fmac_dev_ctx *fmac_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
+
 #endif /* __FMAC_PEER_H__ */
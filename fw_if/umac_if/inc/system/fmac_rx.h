@@ -20,6 +20,12 @@
 #include "system/fmac_structs.h"
 #define RX_BUF_HEADROOM 4
 
+#ifdef NRF70_RAW_RX_BATCH
+#define RX_BUF_META_LEN NRF70_RAW_RX_META_LEN
+#else
+#define RX_BUF_META_LEN 0
+#endif /* NRF70_RAW_RX_BATCH */
+
 enum nrf_wifi_fmac_rx_cmd_type {
 	NRF_WIFI_FMAC_RX_CMD_TYPE_INIT,
 	NRF_WIFI_FMAC_RX_CMD_TYPE_DEINIT,
@@ -42,6 +48,24 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 
 void nrf_wifi_fmac_rx_tasklet(void *data);
 
+enum nrf_wifi_status nrf_wifi_fmac_rx_desc_map_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+void nrf_wifi_fmac_rx_desc_map_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+#ifdef NRF70_RX_BUF_RECYCLE
+enum nrf_wifi_status nrf_wifi_fmac_rx_buf_free_list_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+void nrf_wifi_fmac_rx_buf_free_list_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+void nrf_wifi_fmac_rx_buf_put(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      unsigned int pool_id,
+			      void *nwb);
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+void nrf_wifi_fmac_rx_refill_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 unsigned long nrf_wifi_fmac_get_rx_buf_map_addr(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	unsigned int desc_id);
@@ -95,6 +95,42 @@ struct raw_rx_pkt_header {
 	/** Data rate of the packet (MCS or Legacy). */
 	unsigned char rate;
 };
+
+#if defined(NRF70_RAW_RX_BATCH) || defined(__DOXYGEN__)
+#ifndef NRF70_RAW_RX_BATCH_MAX
+/** Maximum number of raw frames handed over in one batch. */
+#define NRF70_RAW_RX_BATCH_MAX 16
+#endif /* NRF70_RAW_RX_BATCH_MAX */
+
+/** Headroom reserved in the RX buffers for the raw frame metadata. */
+#define NRF70_RAW_RX_META_LEN sizeof(struct raw_rx_pkt_header)
+
+/**
+ * @brief Raw RX batching statistics.
+ */
+struct nrf_wifi_fmac_raw_rx_batch_stats {
+	/** Number of batches handed over. */
+	unsigned int num_batches;
+	/** Number of raw frames handed over in batches. */
+	unsigned int num_frms;
+	/** Number of raw frames dropped by the packet filter. */
+	unsigned int num_filtered;
+	/** Largest batch handed over. */
+	unsigned int max_batch_len;
+};
+
+/**
+ * @brief Raw frames pending hand over to the upper layer.
+ */
+struct nrf_wifi_fmac_raw_rx_batch {
+	/** Pending frames, each prefixed with its &struct raw_rx_pkt_header. */
+	void *frms[NRF70_RAW_RX_BATCH_MAX];
+	/** Number of pending frames. */
+	unsigned int num_frms;
+	/** Batching statistics. */
+	struct nrf_wifi_fmac_raw_rx_batch_stats stats;
+};
+#endif /* NRF70_RAW_RX_BATCH */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 
 /**
@@ -281,7 +317,25 @@ struct nrf_wifi_fmac_callbk_fns {
 				  void *frm,
 				  struct raw_rx_pkt_header *,
 				  bool pkt_free);
+#if defined(NRF70_RAW_RX_BATCH) || defined(__DOXYGEN__)
+	/** Callback function to be called with a batch of raw frames. Each frame
+	 *  starts with its &struct raw_rx_pkt_header, the frames are owned by the
+	 *  callee. Takes precedence over sniffer_callbk_fn for raw frames.
+	 */
+	void (*sniffer_batch_callbk_fn)(void *os_vif_ctx,
+					void **frms,
+					unsigned int num_frms);
+#endif /* NRF70_RAW_RX_BATCH */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
+#if defined(NRF70_RAW_TX_BATCH) || defined(__DOXYGEN__)
+	/** Callback function to be called once all the frames of a raw TX batch
+	 *  have been completed. Called without the TX lock held.
+	 */
+	void (*raw_tx_batch_done_callbk_fn)(void *os_vif_ctx,
+					    void *cookie,
+					    unsigned int num_frms,
+					    unsigned int num_failed);
+#endif /* NRF70_RAW_TX_BATCH */
 	void (*reg_change_callbk_fn)(void *os_vif_ctx,
 				     struct nrf_wifi_event_regulatory_change *reg_change,
 				     unsigned int event_len);
@@ -300,6 +354,122 @@ enum nrf_wifi_fmac_twt_state {
 };
 #endif /* NRF70_STA_MODE */
 
+#if defined(NRF70_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+/** Number of bins in a TX latency histogram. */
+#define NRF_WIFI_TX_LAT_HIST_BINS 8
+
+/**
+ * @brief Latency histogram for one stage of the TX path.
+ *
+ * The bin upper bounds are 500, 1000, 2000, 5000, 10000, 20000 and 50000
+ * units, the last bin holds all larger samples.
+ */
+struct nrf_wifi_tx_lat_hist {
+	/** Number of samples in each bin. */
+	unsigned int bins[NRF_WIFI_TX_LAT_HIST_BINS];
+	/** Total number of samples. */
+	unsigned int count;
+	/** Largest sample seen. */
+	unsigned int max;
+	/** Sum of all samples, used to derive the mean. */
+	unsigned long long sum;
+};
+
+/**
+ * @brief Per access category TX latency statistics.
+ *
+ */
+struct nrf_wifi_tx_lat_stats {
+	/** Time (us) from nrf_wifi_fmac_start_xmit until the frame is posted to the RPU. */
+	struct nrf_wifi_tx_lat_hist enq_to_post[NRF_WIFI_FMAC_AC_MAX];
+	/** Time (us) from posting the TX command until the TX done event. */
+	struct nrf_wifi_tx_lat_hist post_to_done[NRF_WIFI_FMAC_AC_MAX];
+	/** PHY TX to ACK time (timestamp_t4 - timestamp_t1) in PHY timer units. */
+	struct nrf_wifi_tx_lat_hist phy_t1_t4[NRF_WIFI_FMAC_AC_MAX];
+};
+#endif /* NRF70_TX_LATENCY_STATS */
+
+#if defined(NRF70_TX_AQM) || defined(__DOXYGEN__)
+#ifndef NRF70_TX_AQM_TARGET_US
+/** Acceptable standing queue delay (us) for the CoDel AQM. */
+#define NRF70_TX_AQM_TARGET_US 5000
+#endif /* NRF70_TX_AQM_TARGET_US */
+
+#ifndef NRF70_TX_AQM_INTERVAL_US
+/** Window (us) over which the queue delay must stay above target before dropping. */
+#define NRF70_TX_AQM_INTERVAL_US 100000
+#endif /* NRF70_TX_AQM_INTERVAL_US */
+
+/**
+ * @brief CoDel state of a pending TX queue.
+ *
+ */
+struct nrf_wifi_tx_aqm_state {
+	/** Time (us) at which the sojourn time will have been above target for an interval. */
+	unsigned long first_above_time;
+	/** Time (us) of the next drop while in the dropping state. */
+	unsigned long drop_next;
+	/** Number of drops since entering the dropping state. */
+	unsigned int count;
+	/** Value of count when the dropping state was last left. */
+	unsigned int lastcount;
+	/** Whether the queue is in the dropping state. */
+	bool dropping;
+};
+
+/**
+ * @brief AQM statistics of a pending TX queue.
+ *
+ */
+struct nrf_wifi_tx_aqm_stats {
+	/** Frames dropped by the AQM. */
+	unsigned int drops;
+	/** ECN capable frames marked with CE instead of being dropped. */
+	unsigned int marks;
+	/** Frames dropped because the queue was full. */
+	unsigned int tail_drops;
+	/** Largest sojourn time (us) seen at dequeue. */
+	unsigned int max_sojourn_us;
+};
+#endif /* NRF70_TX_AQM */
+
+#if defined(NRF70_TX_FLOW_CACHE) || defined(__DOXYGEN__)
+#ifndef NRF70_TX_FLOW_CACHE_SIZE
+/** Number of entries in the TX flow cache, needs to be a power of 2. */
+#define NRF70_TX_FLOW_CACHE_SIZE 8
+#endif /* NRF70_TX_FLOW_CACHE_SIZE */
+
+/**
+ * @brief Classification result of a TX flow.
+ *
+ */
+struct nrf_wifi_tx_flow {
+	/** Destination address of the flow. */
+	unsigned char dst[NRF_WIFI_ETH_ADDR_LEN];
+	/** VIF index of the flow. */
+	unsigned char if_idx;
+	/** TID derived from the DSCP/802.1D priority of the flow. */
+	unsigned char tid;
+	/** Peer ID the flow is sent to. */
+	int peer_id;
+	/** Access category the flow is sent on. */
+	unsigned int ac;
+	/** Cache generation the entry was filled in, the entry is stale if it is not current. */
+	unsigned int gen;
+};
+
+/**
+ * @brief Direct mapped cache of TX flow classification results.
+ *
+ */
+struct nrf_wifi_tx_flow_cache {
+	/** Flow entries. */
+	struct nrf_wifi_tx_flow flows[NRF70_TX_FLOW_CACHE_SIZE];
+	/** Current generation, bumped to invalidate all the entries. */
+	unsigned int gen;
+};
+#endif /* NRF70_TX_FLOW_CACHE */
+
 #if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX) || defined(__DOXYGEN__)
 /**
  * @brief Structure to hold peer context information.
@@ -353,6 +523,10 @@ struct tx_config {
 	unsigned int curr_peer_opp[NRF_WIFI_FMAC_AC_MAX];
 	/** Access category which will get the next spare descriptor. */
 	unsigned int next_spare_desc_ac;
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+	/** Sequence number given to the next TX descriptor which is filled. */
+	unsigned int send_seq;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 	/** Frame context information. */
 	struct tx_pkt_info *pkt_info_p;
 	/** Map for the spare descriptor queues
@@ -364,6 +538,31 @@ struct tx_config {
 	/** Queue for TX done tasklet. */
 	void *tx_done_tasklet_event_q;
 #endif /* NRF70_TX_DONE_WQ_ENABLED */
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF70_TX_AQM) || defined(__DOXYGEN__)
+#if NRF70_MAX_TX_PENDING_QLEN > 256
+#error "NRF70_MAX_TX_PENDING_QLEN does not fit the pend_q_tstamp_head ring index"
+#endif /* NRF70_MAX_TX_PENDING_QLEN > 256 */
+	/** Enqueue timestamps (us) of the frames in data_pending_txq, one ring per queue. */
+	unsigned long pend_q_tstamp[MAX_SW_PEERS][NRF_WIFI_FMAC_AC_MAX][NRF70_MAX_TX_PENDING_QLEN];
+	/** Index of the oldest entry in each pend_q_tstamp ring. */
+	unsigned char pend_q_tstamp_head[MAX_SW_PEERS][NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF70_TX_LATENCY_STATS || NRF70_TX_AQM */
+#if defined(NRF70_TX_AQM) || defined(__DOXYGEN__)
+	/** CoDel state per pending queue. */
+	struct nrf_wifi_tx_aqm_state aqm[MAX_SW_PEERS][NRF_WIFI_FMAC_AC_MAX];
+	/** AQM statistics per pending queue. */
+	struct nrf_wifi_tx_aqm_stats aqm_stats[MAX_SW_PEERS][NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF70_TX_AQM */
+#if defined(NRF70_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+	/** Enqueue timestamps (us) of the frames attached to each TX descriptor. */
+	unsigned long *desc_enq_tstamp_p;
+	/** TX latency histograms. */
+	struct nrf_wifi_tx_lat_stats lat_stats;
+#endif /* NRF70_TX_LATENCY_STATS */
+#if defined(NRF70_TX_FLOW_CACHE) || defined(__DOXYGEN__)
+	/** Classification results of recently sent flows. */
+	struct nrf_wifi_tx_flow_cache flow_cache;
+#endif /* NRF70_TX_FLOW_CACHE */
 };
 #endif /* NRF70_STA_MODE || NRF70_RAW_DATA_RX */
 
@@ -460,8 +659,249 @@ struct raw_tx_stats {
 	/** Total number of raw packets sent. */
 	unsigned int raw_pkt_send_success;;
 };
+
+#if defined(NRF70_RAW_TX_BATCH) || defined(__DOXYGEN__)
+#ifndef NRF70_RAW_TX_BATCH_SLOTS
+/** Number of raw TX batches which can be in flight at a time. */
+#define NRF70_RAW_TX_BATCH_SLOTS 4
+#endif /* NRF70_RAW_TX_BATCH_SLOTS */
+
+/**
+ * @brief Raw TX batch in flight.
+ */
+struct nrf_wifi_fmac_raw_tx_batch {
+	/** Caller context reported on completion of the batch. */
+	void *cookie;
+	/** Index of the interface the batch was submitted on. */
+	unsigned char if_idx;
+	/** Number of frames in the batch. */
+	unsigned int num_frms;
+	/** Number of frames which were completed or dropped. */
+	unsigned int num_done;
+	/** Number of frames which failed or were dropped. */
+	unsigned int num_failed;
+	/** The slot holds a batch in flight. */
+	bool in_use;
+};
+
+/**
+ * @brief Raw TX batching statistics.
+ */
+struct nrf_wifi_fmac_raw_tx_batch_stats {
+	/** Number of batches submitted. */
+	unsigned int num_batches;
+	/** Number of frames submitted in batches. */
+	unsigned int num_frms;
+	/** Number of TX commands used for the batched frames. */
+	unsigned int num_cmds;
+	/** Number of batches rejected as all the slots were in use. */
+	unsigned int num_no_slot;
+};
+#endif /* NRF70_RAW_TX_BATCH */
 #endif /* NRF70_RAW_DATA_TX */
 
+#if defined(NRF70_RX_BUF_RECYCLE) || defined(__DOXYGEN__)
+/**
+ * @brief Free list of RX buffers of a RX buffer pool.
+ *
+ * Holds RX buffers which were dropped by the driver or returned by the
+ * upper layer, so that they can be handed back to the RPU without going
+ * through the OS allocator.
+ */
+struct nrf_wifi_fmac_rx_buf_free_list {
+	/** Buffers available for reuse. */
+	void **bufs;
+	/** Maximum number of buffers in the free list. */
+	unsigned int max_bufs;
+	/** Number of buffers in the free list. */
+	unsigned int num_bufs;
+};
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+#if defined(NRF_WIFI_OSAL_NBUF_BULK) || defined(__DOXYGEN__)
+/** Number of RX buffers allocated at a time to refill a RX buffer pool. */
+#define NRF_WIFI_FMAC_RX_REFILL_BULK 8
+
+/**
+ * @brief Stash of freshly allocated RX buffers of a RX buffer pool.
+ *
+ * Filled using a single bulk allocation whenever it runs empty, so that
+ * handing RX buffers back to the RPU does not go through the OS
+ * allocator for every frame.
+ */
+struct nrf_wifi_fmac_rx_refill {
+	/** Allocated buffers, with the RX headroom already reserved. */
+	void *bufs[NRF_WIFI_FMAC_RX_REFILL_BULK];
+	/** Number of buffers in the stash. */
+	unsigned int num_bufs;
+};
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+/**
+ * @brief VIF configuration replayed to the RPU after a fast recovery.
+ *
+ * Holds copies of the last commands which configured the VIF in the RPU,
+ * NULL for the ones which were never sent. Connections and their keys are
+ * not replayed, the upper layers reconnect instead.
+ */
+struct nrf_wifi_fmac_vif_recovery_info {
+	/** Command which created the VIF, NULL for the default VIF. */
+	struct nrf_wifi_umac_cmd_add_vif *add_vif_cmd;
+	/** Last interface type change. */
+	struct nrf_wifi_umac_cmd_chg_vif_attr *chg_vif_cmd;
+	/** Last MAC address change. */
+	struct nrf_wifi_umac_cmd_change_macaddr *macaddr_cmd;
+	/** Last interface state change. */
+	struct nrf_wifi_umac_cmd_chg_vif_state *chg_vif_state_cmd;
+};
+
+/**
+ * @brief Device configuration used to bring the RPU back up after a fast recovery.
+ */
+struct nrf_wifi_fmac_recovery_info {
+#if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
+	/** Sleep type passed at device init. */
+	int sleep_type;
+#endif /* NRF_WIFI_LOW_POWER */
+	/** PHY calibration flags passed at device init. */
+	unsigned int phy_calib;
+	/** Operating band passed at device init. */
+	enum op_band op_band;
+	/** Beamforming setting passed at device init. */
+	bool beamforming;
+	/** TX power control parameters passed at device init. */
+	struct nrf_wifi_tx_pwr_ctrl_params tx_pwr_ctrl;
+	/** Board parameters passed at device init. */
+	struct nrf_wifi_board_params board_params;
+	/** Country code passed at device init. */
+	unsigned char country_code[NRF_WIFI_COUNTRY_CODE_LEN];
+	/** A fast recovery is in progress, TX frames are only queued. */
+	bool in_progress;
+	/** Number of fast recoveries which were completed. */
+	unsigned int num_recoveries;
+	/** Number of fast recoveries which failed. */
+	unsigned int num_failures;
+	/** Number of TX frames requeued by fast recoveries. */
+	unsigned int num_requeued_frames;
+	/** Number of TX frames for unicast peers dropped by fast recoveries. */
+	unsigned int num_dropped_frames;
+};
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+#if defined(NRF_WIFI_SCAN_CACHE) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_FMAC_BSS_CACHE_SIZE
+/** Number of BSSs held in the scan result cache. */
+#define NRF_WIFI_FMAC_BSS_CACHE_SIZE 32
+#endif /* NRF_WIFI_FMAC_BSS_CACHE_SIZE */
+
+#ifndef NRF_WIFI_FMAC_BSS_CACHE_AGE_MS
+/** Time (ms) after which a BSS which was not reported again is dropped from the cache. */
+#define NRF_WIFI_FMAC_BSS_CACHE_AGE_MS 30000
+#endif /* NRF_WIFI_FMAC_BSS_CACHE_AGE_MS */
+
+/**
+ * @brief BSS returned by the scan result cache.
+ */
+struct nrf_wifi_fmac_bss_cache_entry {
+	/** Latest information reported for the BSS. */
+	struct umac_display_results res;
+	/** Time (ms) since the BSS was last reported by the RPU. */
+	unsigned int age_ms;
+	/** Number of scan results merged into this entry. */
+	unsigned int num_seen;
+};
+
+/**
+ * @brief Scan result cache statistics.
+ */
+struct nrf_wifi_fmac_bss_cache_stats {
+	/** Number of BSSs currently in the cache. */
+	unsigned int num_entries;
+	/** Number of scan results received from the RPU. */
+	unsigned int num_results;
+	/** Number of scan results which updated a BSS already in the cache. */
+	unsigned int num_dups;
+	/** Number of BSSs dropped after not being reported for NRF_WIFI_FMAC_BSS_CACHE_AGE_MS. */
+	unsigned int num_aged;
+	/** Number of BSSs evicted to make room for a new one. */
+	unsigned int num_evicted;
+};
+
+/**
+ * @brief Slot of the scan result cache.
+ */
+struct nrf_wifi_fmac_bss_cache_slot {
+	/** Latest information reported for the BSS. */
+	struct umac_display_results res;
+	/** Time (ms) at which the BSS was last reported by the RPU. */
+	unsigned long last_seen_ms;
+	/** Number of scan results merged into this slot. */
+	unsigned int num_seen;
+	/** The slot holds a BSS. */
+	bool valid;
+};
+
+/**
+ * @brief Cache of the BSSs reported by scans, deduplicated by BSSID.
+ */
+struct nrf_wifi_fmac_bss_cache {
+	/** Lock protecting the cache. */
+	void *lock;
+	/** Cached BSSs. */
+	struct nrf_wifi_fmac_bss_cache_slot slots[NRF_WIFI_FMAC_BSS_CACHE_SIZE];
+	/** Cache statistics. */
+	struct nrf_wifi_fmac_bss_cache_stats stats;
+};
+#endif /* NRF_WIFI_SCAN_CACHE */
+
+/** Number of UMAC event IDs covered by the event dispatch table. */
+#define NRF_WIFI_UMAC_EVENT_NUM (NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO - \
+				 NRF_WIFI_UMAC_EVENT_UNSPECIFIED + 1)
+
+struct nrf_wifi_fmac_dev_ctx;
+struct nrf_wifi_fmac_vif_ctx;
+
+/**
+ * @brief Handler for a UMAC event.
+ *
+ * Called from the event context with the VIF the event is addressed to.
+ * The event length has already been checked against the minimum length
+ * registered for the event.
+ */
+typedef enum nrf_wifi_status (*nrf_wifi_umac_event_handler_t)(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+							      void *event_data,
+							      unsigned int event_len);
+
+/**
+ * @brief Dispatch information for a UMAC event.
+ *
+ */
+struct nrf_wifi_umac_event_desc {
+	/** Handler for the event. */
+	nrf_wifi_umac_event_handler_t handler;
+	/** Minimum length of the event. */
+	unsigned int min_len;
+};
+
+/**
+ * @brief Processing statistics for a UMAC event.
+ *
+ */
+struct nrf_wifi_umac_event_stats {
+	/** Number of events received. */
+	unsigned int count;
+	/** Number of events dropped for being shorter than the minimum length. */
+	unsigned int len_errs;
+	/** Number of events for which the handler reported a failure. */
+	unsigned int handler_errs;
+	/** Largest time (us) spent in the handler. */
+	unsigned int max_time_us;
+	/** Total time (us) spent in the handler. */
+	unsigned long long total_time_us;
+};
+
 /**
  * @brief Structure to hold per device context information for the UMAC IF layer.
  *
@@ -485,6 +925,18 @@ struct nrf_wifi_sys_fmac_dev_ctx {
 	unsigned char num_ap;
 	/** Queue for storing mapping info of RX buffers. */
 	struct nrf_wifi_fmac_buf_map_info *rx_buf_info;
+	/** RX buffer pool and buffer index of each RX descriptor. */
+	struct nrf_wifi_fmac_rx_pool_map_info *rx_desc_map;
+#if defined(NRF70_RX_BUF_RECYCLE) || defined(__DOXYGEN__)
+	/** Free lists of reusable RX buffers, one per RX buffer pool. */
+	struct nrf_wifi_fmac_rx_buf_free_list rx_buf_free_list[MAX_NUM_OF_RX_QUEUES];
+	/** Lock for the RX buffer free lists. */
+	void *rx_buf_free_list_lock;
+#endif /* NRF70_RX_BUF_RECYCLE */
+#if defined(NRF_WIFI_OSAL_NBUF_BULK) || defined(__DOXYGEN__)
+	/** Stashes of bulk allocated RX buffers, one per RX buffer pool. */
+	struct nrf_wifi_fmac_rx_refill rx_refill[MAX_NUM_OF_RX_QUEUES];
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 #if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
 	/** Context information related to TX path. */
 	struct tx_config tx_config;
@@ -502,7 +954,29 @@ struct nrf_wifi_sys_fmac_dev_ctx {
 #ifdef NRF70_RAW_DATA_TX
 	struct raw_tx_pkt_header raw_tx_config;
 	struct raw_tx_stats raw_pkt_stats;
+#if defined(NRF70_RAW_TX_BATCH) || defined(__DOXYGEN__)
+	/** Raw TX batches in flight. */
+	struct nrf_wifi_fmac_raw_tx_batch raw_tx_batch[NRF70_RAW_TX_BATCH_SLOTS];
+	/** Raw TX batching statistics. */
+	struct nrf_wifi_fmac_raw_tx_batch_stats raw_tx_batch_stats;
+#endif /* NRF70_RAW_TX_BATCH */
 #endif /* NRF70_RAW_DATA_TX */
+	/** Handlers registered at runtime, these take precedence over the built-in ones. */
+	struct nrf_wifi_umac_event_desc umac_event_handlers[NRF_WIFI_UMAC_EVENT_NUM];
+	/** Per event processing statistics. */
+	struct nrf_wifi_umac_event_stats umac_event_stats[NRF_WIFI_UMAC_EVENT_NUM];
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+	/** Configuration used to bring the RPU back up after a fast recovery. */
+	struct nrf_wifi_fmac_recovery_info recovery;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+#if defined(NRF70_RAW_RX_BATCH) || defined(__DOXYGEN__)
+	/** Raw frames pending hand over to the upper layer. */
+	struct nrf_wifi_fmac_raw_rx_batch raw_rx_batch;
+#endif /* NRF70_RAW_RX_BATCH */
+#if defined(NRF_WIFI_SCAN_CACHE) || defined(__DOXYGEN__)
+	/** Cache of the BSSs reported by scans. */
+	struct nrf_wifi_fmac_bss_cache bss_cache;
+#endif /* NRF_WIFI_SCAN_CACHE */
 };
 
 /**
@@ -542,6 +1016,10 @@ struct nrf_wifi_fmac_vif_ctx {
 	/** Promiscuous mode setting */
 	bool promisc_mode;
 #endif /* NRF70_PROMISC_DATA_RX */
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+	/** Configuration replayed to the RPU after a fast recovery. */
+	struct nrf_wifi_fmac_vif_recovery_info recovery;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 };
 
 /**
@@ -66,6 +66,25 @@ struct tx_pkt_info {
 	void *pkt;
 	/** Peer ID. */
 	unsigned int peer_id;
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF_WIFI_RPU_FAST_RECOVERY) || \
+	defined(__DOXYGEN__)
+	/** Access category the frames were dequeued from. */
+	unsigned int ac;
+#endif /* NRF70_TX_LATENCY_STATS || NRF_WIFI_RPU_FAST_RECOVERY */
+#if defined(NRF70_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+	/** Time (us) at which the TX command was posted, 0 if not posted. */
+	unsigned long post_tstamp_us;
+#endif /* NRF70_TX_LATENCY_STATS */
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+	/** Frames handed to the RPU and not yet completed, requeued on a fast recovery. */
+	void *sent;
+	/** Order in which the descriptor was filled, used to requeue in send order. */
+	unsigned int send_seq;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+#if defined(NRF70_RAW_TX_BATCH) || defined(__DOXYGEN__)
+	/** Raw TX batch (slot + 1) the frames belong to, 0 if none. */
+	unsigned char raw_tx_batch;
+#endif /* NRF70_RAW_TX_BATCH */
 };
 
 #ifdef NRF70_RAW_DATA_TX
@@ -128,7 +147,7 @@ enum nrf_wifi_status nrf_wifi_fmac_tx_done_event_process(struct nrf_wifi_fmac_de
 enum nrf_wifi_status
 nrf_wifi_fmac_rawtx_done_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		struct nrf_wifi_event_raw_tx_done *config);
-#endif /* CONFIG_NRF70_RAW_DATA_TX */
+#endif /* NRF70_RAW_DATA_TX */
 
 /**
  * @brief Get a TX descriptor from the specified queue.
@@ -178,6 +197,29 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_ctx,
 		unsigned int desc,
 		unsigned char *ac);
 
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(__DOXYGEN__)
+/**
+ * @brief Requeue the frames attached to TX descriptors after an RPU recovery.
+ *
+ * Moves the frames which were handed to the RPU, or were waiting for a
+ * descriptor to be sent, back to the head of their pending queues in the
+ * order in which they were sent, and marks all TX descriptors as free.
+ * The restarted RPU has no connections, so frames for unicast peers, both
+ * the ones attached to descriptors and the pending ones, are dropped.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ * @return The number of frames requeued.
+ */
+unsigned int tx_recovery_requeue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+/**
+ * @brief Restart the transmission of the pending frames after an RPU recovery.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ */
+void tx_recovery_resume(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
 /** @} */
 
 #endif /* __FMAC_TX_H__ */
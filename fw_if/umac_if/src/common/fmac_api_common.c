@@ -703,3 +703,72 @@ out:
 
 	return status;
 }
+
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+enum nrf_wifi_status nrf_wifi_fmac_cmd_q_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						   struct nrf_wifi_hal_cmd_q_stats *stats,
+						   bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_hal_cmd_q_stats_get(fmac_dev_ctx->hal_dev_ctx,
+					      stats,
+					      reset);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+enum nrf_wifi_status nrf_wifi_fmac_hal_event_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						       struct nrf_wifi_hal_event_stats *stats,
+						       bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_hal_event_stats_get(fmac_dev_ctx->hal_dev_ctx,
+					      stats,
+					      reset);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+#if defined(NRF_WIFI_HAL_BUS_SELFTEST) && !defined(NRF71_ON_IPC)
+enum nrf_wifi_status nrf_wifi_fmac_bus_selftest(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						unsigned int num_iters,
+						struct nrf_wifi_hal_bus_selftest *result)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx || !result) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->fw_boot_done) {
+		nrf_wifi_osal_log_err("%s: Firmware already running",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_hal_bus_selftest(fmac_dev_ctx->hal_dev_ctx,
+					   num_iters,
+					   result);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_BUS_SELFTEST && !NRF71_ON_IPC */
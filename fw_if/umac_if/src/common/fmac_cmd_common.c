@@ -9,6 +9,8 @@
  * FMAC IF Layer of the Wi-Fi driver.
  */
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_CMD
+
 #include "common/hal_api_common.h"
 
 #ifdef NRF71_ON_IPC
@@ -85,6 +87,54 @@ out:
 }
 
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+enum nrf_wifi_status umac_cmd_cfg_async(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					void *params,
+					int len,
+					void (*callbk_fn)(void *callbk_data,
+							  enum nrf_wifi_status status),
+					void *callbk_data)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct host_rpu_msg *umac_cmd = NULL;
+
+	if (!fmac_dev_ctx->fw_init_done) {
+		nrf_wifi_osal_log_err("%s: UMAC buff config not yet done(%d)",
+				      __func__,
+				      ((struct nrf_wifi_umac_hdr *)params)->cmd_evnt);
+		goto out;
+	}
+
+	umac_cmd = umac_cmd_alloc(fmac_dev_ctx,
+				  NRF_WIFI_HOST_RPU_MSG_TYPE_UMAC,
+				  len);
+
+	if (!umac_cmd) {
+		nrf_wifi_osal_log_err("%s: umac_cmd_alloc failed",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_cpy(umac_cmd->msg,
+			      params,
+			      len);
+
+	status = nrf_wifi_hal_ctrl_cmd_send_async(fmac_dev_ctx->hal_dev_ctx,
+						  umac_cmd,
+						  (sizeof(*umac_cmd) + len),
+						  callbk_fn,
+						  callbk_data);
+
+	nrf_wifi_osal_log_dbg("%s: Command %d queued for RPU",
+			      __func__,
+			      ((struct nrf_wifi_umac_hdr *)params)->cmd_evnt);
+
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+
 enum nrf_wifi_status umac_cmd_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
@@ -21,6 +21,9 @@
 #include "offload_raw_tx/fmac_event.h"
 #include "offload_raw_tx/fmac_structs.h"
 #include "common/fmac_util.h"
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+#include "common/hal_mem.h"
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
 #include <stdio.h>
 
 static enum nrf_wifi_status nrf_wifi_fmac_off_raw_tx_fw_init(
@@ -163,6 +166,10 @@ struct nrf_wifi_fmac_dev_ctx *nrf_wifi_off_raw_tx_fmac_dev_add(struct nrf_wifi_f
 	}
 
 	fmac_dev_ctx->op_mode = NRF_WIFI_OP_MODE_OFF_RAW_TX;
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+	off_raw_tx_fmac_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	off_raw_tx_fmac_dev_ctx->tmpl_active = NRF_WIFI_OFF_RAW_TX_TMPL_NONE;
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
 out:
 	return fmac_dev_ctx;
 }
@@ -277,6 +284,10 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_conf(struct nrf_wifi_fmac_dev_ctx
 
 	dev_ctx_off_raw_tx = wifi_dev_priv(fmac_dev_ctx);
 	dev_ctx_off_raw_tx->off_raw_tx_cmd_done = true;
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+	/* A direct configuration replaces whatever template was active */
+	dev_ctx_off_raw_tx->tmpl_active = NRF_WIFI_OFF_RAW_TX_TMPL_NONE;
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
 
 	if (!off_ctrl_params || !off_tx_params) {
 		nrf_wifi_osal_log_err("%s: Invalid offloaded raw tx params",
@@ -378,6 +389,201 @@ out:
 }
 
 
+#ifdef NRF_WIFI_OFF_RAW_TX_TMPL_BANK
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_load(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							unsigned char idx,
+							struct nrf_wifi_offload_ctrl_params *off_ctrl_params,
+							struct nrf_wifi_offload_tx_ctrl *off_tx_params,
+							const void *pkt)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_off_raw_tx_fmac_dev_ctx *dev_ctx_off_raw_tx;
+	struct nrf_wifi_off_raw_tx_tmpl *tmpl;
+	unsigned int rpu_addr = 0;
+
+	if (!fmac_dev_ctx) {
+		nrf_wifi_osal_log_err("%s: Invalid device context",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_OFF_RAW_TX) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	if (!off_ctrl_params || !off_tx_params || !pkt) {
+		nrf_wifi_osal_log_err("%s: Invalid offloaded raw tx params",
+				      __func__);
+		goto out;
+	}
+
+	if (idx >= NRF_WIFI_OFF_RAW_TX_TMPL_MAX) {
+		nrf_wifi_osal_log_err("%s: Invalid template index %d",
+				      __func__,
+				      idx);
+		goto out;
+	}
+
+	if (!off_tx_params->pkt_length ||
+	    off_tx_params->pkt_length > NRF_WIFI_OFF_RAW_TX_TMPL_SLOT_LEN) {
+		nrf_wifi_osal_log_err("%s: Invalid packet length %d",
+				      __func__,
+				      off_tx_params->pkt_length);
+		goto out;
+	}
+
+	dev_ctx_off_raw_tx = wifi_dev_priv(fmac_dev_ctx);
+
+	/* The firmware may be transmitting from the active slot */
+	if (idx == dev_ctx_off_raw_tx->tmpl_active) {
+		nrf_wifi_osal_log_err("%s: Template %d is active",
+				      __func__,
+				      idx);
+		goto out;
+	}
+
+#ifdef NRF71_ON_IPC
+	nrf_wifi_osal_log_err("%s: Not supported",
+			      __func__);
+	goto out;
+#else
+	tmpl = &dev_ctx_off_raw_tx->tmpl[idx];
+	tmpl->valid = false;
+
+	rpu_addr = RPU_MEM_PKT_BASE + (idx * NRF_WIFI_OFF_RAW_TX_TMPL_SLOT_LEN);
+
+	status = hal_rpu_mem_write(fmac_dev_ctx->hal_dev_ctx,
+				   rpu_addr,
+				   (void *)pkt,
+				   off_tx_params->pkt_length);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: hal_rpu_mem_write failed",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_cpy(&tmpl->ctrl_params,
+			      off_ctrl_params,
+			      sizeof(tmpl->ctrl_params));
+
+	nrf_wifi_osal_mem_cpy(&tmpl->tx_params,
+			      off_tx_params,
+			      sizeof(tmpl->tx_params));
+
+	tmpl->tx_params.pkt_ram_ptr = rpu_addr;
+	tmpl->valid = true;
+
+	dev_ctx_off_raw_tx->tmpl_stats.num_loads++;
+#endif /* NRF71_ON_IPC */
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_switch(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							  unsigned char idx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_off_raw_tx_fmac_dev_ctx *dev_ctx_off_raw_tx;
+	struct nrf_wifi_off_raw_tx_tmpl *tmpl;
+
+	if (!fmac_dev_ctx) {
+		nrf_wifi_osal_log_err("%s: Invalid device context",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_OFF_RAW_TX) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	if (idx >= NRF_WIFI_OFF_RAW_TX_TMPL_MAX) {
+		nrf_wifi_osal_log_err("%s: Invalid template index %d",
+				      __func__,
+				      idx);
+		goto out;
+	}
+
+	dev_ctx_off_raw_tx = wifi_dev_priv(fmac_dev_ctx);
+	tmpl = &dev_ctx_off_raw_tx->tmpl[idx];
+
+	if (!tmpl->valid) {
+		nrf_wifi_osal_log_err("%s: Template %d not loaded",
+				      __func__,
+				      idx);
+		goto out;
+	}
+
+	if (idx == dev_ctx_off_raw_tx->tmpl_active) {
+		dev_ctx_off_raw_tx->tmpl_stats.num_switches_skipped++;
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+
+	/* Only the parameters are sent, the payload is already in the RPU
+	 * and the stream keeps running across the reconfiguration.
+	 */
+	status = nrf_wifi_off_raw_tx_fmac_conf(fmac_dev_ctx,
+					       &tmpl->ctrl_params,
+					       &tmpl->tx_params);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Switch to template %d failed",
+				      __func__,
+				      idx);
+		goto out;
+	}
+
+	dev_ctx_off_raw_tx->tmpl_active = idx;
+	dev_ctx_off_raw_tx->tmpl_stats.num_switches++;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_tmpl_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							     struct nrf_wifi_off_raw_tx_tmpl_stats *stats,
+							     bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_off_raw_tx_fmac_dev_ctx *dev_ctx_off_raw_tx;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_OFF_RAW_TX) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	dev_ctx_off_raw_tx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &dev_ctx_off_raw_tx->tmpl_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&dev_ctx_off_raw_tx->tmpl_stats,
+				      0,
+				      sizeof(dev_ctx_off_raw_tx->tmpl_stats));
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_OFF_RAW_TX_TMPL_BANK */
+
+
 enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 							enum rpu_op_mode op_mode,
 							struct rpu_off_raw_tx_op_stats *stats)
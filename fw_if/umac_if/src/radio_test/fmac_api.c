@@ -915,6 +915,264 @@ out:
 	return status;
 }
 
+#ifdef NRF_WIFI_RT_SWEEP
+static enum nrf_wifi_status rt_sweep_rf_test(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					     enum nrf_wifi_rf_test rf_test_type,
+					     void *rf_test_params,
+					     unsigned int rf_test_params_len)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_rt_fmac_dev_ctx *rt_dev_ctx = NULL;
+	unsigned int timeout = 0;
+	unsigned int count = 0;
+
+	rt_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	rt_dev_ctx->rf_test_type = rf_test_type;
+	rt_dev_ctx->rf_test_cap_data = NULL;
+	rt_dev_ctx->rf_test_cap_sz = 0;
+	rt_dev_ctx->rf_test_val_valid = false;
+
+	status = umac_cmd_rt_prog_rf_test(fmac_dev_ctx,
+					  rf_test_params,
+					  rf_test_params_len);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: umac_cmd_rt_prog_rf_test failed for test %d",
+				      __func__,
+				      rf_test_type);
+		goto out;
+	}
+
+	/* Same overall timeout as the single shot calls, but a much finer
+	 * poll so that the next step is issued as soon as this one is done.
+	 */
+	timeout = (NRF_WIFI_FMAC_RF_TEST_EVNT_TIMEOUT * 100) / NRF_WIFI_RT_SWEEP_POLL_MS;
+
+	do {
+		nrf_wifi_osal_sleep_ms(NRF_WIFI_RT_SWEEP_POLL_MS);
+		count++;
+	} while ((rt_dev_ctx->rf_test_type != NRF_WIFI_RF_TEST_MAX) &&
+		 (count < timeout));
+
+	if (count == timeout) {
+		nrf_wifi_osal_log_err("%s: Timed out for test %d",
+				      __func__,
+				      rf_test_type);
+		rt_dev_ctx->rf_test_type = NRF_WIFI_RF_TEST_MAX;
+		status = NRF_WIFI_STATUS_FAIL;
+		goto out;
+	}
+out:
+	return status;
+}
+
+
+static enum nrf_wifi_status rt_sweep_step_run(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					      const struct nrf_wifi_rt_sweep_step *step,
+					      struct nrf_wifi_rt_sweep_result *result)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_rt_fmac_dev_ctx *rt_dev_ctx = NULL;
+	union {
+		struct nrf_wifi_rf_test_tx_params tx_tone;
+		struct nrf_wifi_rf_test_dpd_params dpd;
+		struct nrf_wifi_rf_get_rf_rssi rf_rssi;
+		struct nrf_wifi_temperature_params temp;
+		struct nrf_wifi_bat_volt_params bat_volt;
+		struct nrf_wifi_rf_test_xo_calib xo_calib;
+		struct nrf_wifi_rf_get_xo_value xo_tune;
+	} params;
+	bool has_val = false;
+
+	rt_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_mem_set(&params,
+			      0,
+			      sizeof(params));
+
+	switch (step->op) {
+	case NRF_WIFI_RT_SWEEP_OP_PROG_TX:
+	case NRF_WIFI_RT_SWEEP_OP_PROG_RX:
+		if (!step->conf) {
+			nrf_wifi_osal_log_err("%s: No configuration for op %d",
+					      __func__,
+					      step->op);
+			goto out;
+		}
+
+		if (step->op == NRF_WIFI_RT_SWEEP_OP_PROG_TX) {
+			status = nrf_wifi_rt_fmac_prog_tx(fmac_dev_ctx,
+							  step->conf);
+		} else {
+			status = nrf_wifi_rt_fmac_prog_rx(fmac_dev_ctx,
+							  step->conf);
+		}
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_TX_TONE:
+		params.tx_tone.test = NRF_WIFI_RF_TEST_TX_TONE;
+		params.tx_tone.tone_freq = step->tone_freq;
+		params.tx_tone.tx_pow = step->tx_power;
+		params.tx_tone.enabled = step->enable;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_TX_TONE,
+					  &params.tx_tone,
+					  sizeof(params.tx_tone));
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_DPD:
+		params.dpd.test = NRF_WIFI_RF_TEST_DPD;
+		params.dpd.enabled = step->enable;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_DPD,
+					  &params.dpd,
+					  sizeof(params.dpd));
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_RF_RSSI:
+		params.rf_rssi.test = NRF_WIFI_RF_TEST_RF_RSSI;
+		params.rf_rssi.lna_gain = 3;
+		params.rf_rssi.bb_gain = 10;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_RF_RSSI,
+					  &params.rf_rssi,
+					  sizeof(params.rf_rssi));
+		has_val = true;
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_TEMP:
+		params.temp.test = NRF_WIFI_RF_TEST_GET_TEMPERATURE;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_GET_TEMPERATURE,
+					  &params.temp,
+					  sizeof(params.temp));
+		has_val = true;
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_BAT_VOLT:
+		params.bat_volt.test = NRF_WIFI_RF_TEST_GET_BAT_VOLT;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_GET_BAT_VOLT,
+					  &params.bat_volt,
+					  sizeof(params.bat_volt));
+		has_val = true;
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_SET_XO:
+		params.xo_calib.test = NRF_WIFI_RF_TEST_XO_CALIB;
+		params.xo_calib.xo_val = step->xo_val;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_XO_CALIB,
+					  &params.xo_calib,
+					  sizeof(params.xo_calib));
+		has_val = true;
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_COMPUTE_XO:
+		params.xo_tune.test = NRF_WIFI_RF_TEST_XO_TUNE;
+
+		status = rt_sweep_rf_test(fmac_dev_ctx,
+					  NRF_WIFI_RF_TEST_XO_TUNE,
+					  &params.xo_tune,
+					  sizeof(params.xo_tune));
+		has_val = true;
+		break;
+	case NRF_WIFI_RT_SWEEP_OP_DWELL:
+		status = NRF_WIFI_STATUS_SUCCESS;
+		break;
+	default:
+		nrf_wifi_osal_log_err("%s: Invalid op %d",
+				      __func__,
+				      step->op);
+		goto out;
+	}
+
+	if ((status == NRF_WIFI_STATUS_SUCCESS) && has_val) {
+		/* The event arrived but the RPU reported a failed reading */
+		if (!rt_dev_ctx->rf_test_val_valid) {
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+
+		result->value = rt_dev_ctx->rf_test_val;
+	}
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_rt_fmac_sweep(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					    const struct nrf_wifi_rt_sweep_step *steps,
+					    unsigned int num_steps,
+					    struct nrf_wifi_rt_sweep_result *results,
+					    bool stop_on_err)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_rt_sweep_result *result = NULL;
+	unsigned long start_time_us = 0;
+	unsigned int num_failed = 0;
+	unsigned int i = 0;
+
+	if (!fmac_dev_ctx || !steps || !num_steps || !results) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_RT) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_set(results,
+			      0,
+			      sizeof(*results) * num_steps);
+
+	for (i = 0; i < num_steps; i++) {
+		results[i].status = NRF_WIFI_STATUS_FAIL;
+	}
+
+	for (i = 0; i < num_steps; i++) {
+		result = &results[i];
+
+		start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+		result->status = rt_sweep_step_run(fmac_dev_ctx,
+						   &steps[i],
+						   result);
+
+		result->duration_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+		if (result->status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Step %d (op %d) failed",
+					      __func__,
+					      i,
+					      steps[i].op);
+			num_failed++;
+
+			if (stop_on_err) {
+				goto out;
+			}
+
+			continue;
+		}
+
+		if (steps[i].dwell_ms) {
+			nrf_wifi_osal_sleep_ms(steps[i].dwell_ms);
+		}
+	}
+
+	if (num_failed) {
+		goto out;
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_RT_SWEEP */
+
 enum nrf_wifi_status nrf_wifi_rt_fmac_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						enum rpu_op_mode op_mode,
 						struct rpu_rt_op_stats *stats)
@@ -116,6 +116,10 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 		} else {
 			nrf_wifi_osal_log_info("The temperature is = %d degree celsius",
 					       rf_test_get_temperature.temperature);
+#ifdef NRF_WIFI_RT_SWEEP
+			def_dev_ctx->rf_test_val = rf_test_get_temperature.temperature;
+			def_dev_ctx->rf_test_val_valid = true;
+#endif /* NRF_WIFI_RT_SWEEP */
 		}
 		break;
 	case NRF_WIFI_RF_TEST_EVENT_GET_BAT_VOLT:
@@ -130,6 +134,10 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 
 			nrf_wifi_osal_log_info("The battery voltage is = %d mV",
 						bat_volt);
+#ifdef NRF_WIFI_RT_SWEEP
+			def_dev_ctx->rf_test_val = bat_volt;
+			def_dev_ctx->rf_test_val_valid = true;
+#endif /* NRF_WIFI_RT_SWEEP */
 		}
 		break;
 	case NRF_WIFI_RF_TEST_EVENT_RF_RSSI:
@@ -139,6 +147,10 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 
 		nrf_wifi_osal_log_info("RF RSSI value is = %d",
 				       rf_get_rf_rssi.agc_status_val);
+#ifdef NRF_WIFI_RT_SWEEP
+		def_dev_ctx->rf_test_val = rf_get_rf_rssi.agc_status_val;
+		def_dev_ctx->rf_test_val_valid = true;
+#endif /* NRF_WIFI_RT_SWEEP */
 		break;
 	case NRF_WIFI_RF_TEST_EVENT_XO_CALIB:
 		nrf_wifi_osal_mem_cpy(&xo_calib_params,
@@ -147,6 +159,10 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 
 		nrf_wifi_osal_log_info("XO value configured is = %d",
 				       xo_calib_params.xo_val);
+#ifdef NRF_WIFI_RT_SWEEP
+		def_dev_ctx->rf_test_val = xo_calib_params.xo_val;
+		def_dev_ctx->rf_test_val_valid = true;
+#endif /* NRF_WIFI_RT_SWEEP */
 		break;
 	case NRF_WIFI_RF_TEST_XO_TUNE:
 		nrf_wifi_osal_mem_cpy(&rf_get_xo_value_params,
@@ -155,6 +171,10 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 
 		nrf_wifi_osal_log_info("Best XO value is = %d",
 				       rf_get_xo_value_params.xo_value);
+#ifdef NRF_WIFI_RT_SWEEP
+		def_dev_ctx->rf_test_val = rf_get_xo_value_params.xo_value;
+		def_dev_ctx->rf_test_val_valid = true;
+#endif /* NRF_WIFI_RT_SWEEP */
 		break;
 	default:
 		break;
@@ -72,6 +72,22 @@ static enum nrf_wifi_status nrf_wifi_sys_fmac_init_tx(struct nrf_wifi_fmac_dev_c
 		goto out;
 	}
 
+#ifdef NRF70_TX_LATENCY_STATS
+	size = (sys_fpriv->num_tx_tokens *
+		sys_fpriv->data_config.max_tx_aggregation *
+		sizeof(unsigned long));
+
+	sys_dev_ctx->tx_config.desc_enq_tstamp_p = nrf_wifi_osal_mem_zalloc(size);
+
+	if (!sys_dev_ctx->tx_config.desc_enq_tstamp_p) {
+		nrf_wifi_osal_log_err("%s: No space for TX enqueue timestamps",
+				      __func__);
+		nrf_wifi_osal_data_mem_free(sys_dev_ctx->tx_buf_info);
+		sys_dev_ctx->tx_buf_info = NULL;
+		goto out;
+	}
+#endif /* NRF70_TX_LATENCY_STATS */
+
 	status = tx_init(fmac_dev_ctx);
 
 out:
@@ -88,6 +104,10 @@ static void nrf_wifi_sys_fmac_deinit_tx(struct nrf_wifi_fmac_dev_ctx *fmac_dev_c
 
 	fpriv = fmac_dev_ctx->fpriv;
 
+#ifdef NRF70_TX_LATENCY_STATS
+	nrf_wifi_osal_mem_free(sys_dev_ctx->tx_config.desc_enq_tstamp_p);
+#endif /* NRF70_TX_LATENCY_STATS */
+
 	tx_deinit(fmac_dev_ctx);
 
 	nrf_wifi_osal_data_mem_free(sys_dev_ctx->tx_buf_info);
@@ -118,6 +138,24 @@ static enum nrf_wifi_status nrf_wifi_sys_fmac_init_rx(struct nrf_wifi_fmac_dev_c
 		goto out;
 	}
 
+	status = nrf_wifi_fmac_rx_desc_map_init(fmac_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RX descriptor map init failed",
+				      __func__);
+		goto out;
+	}
+
+#ifdef NRF70_RX_BUF_RECYCLE
+	status = nrf_wifi_fmac_rx_buf_free_list_init(fmac_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RX buffer free list init failed",
+				      __func__);
+		goto out;
+	}
+#endif /* NRF70_RX_BUF_RECYCLE */
+
 	for (desc_id = 0; desc_id < sys_fpriv->num_rx_bufs; desc_id++) {
 		status = nrf_wifi_fmac_rx_cmd_send(fmac_dev_ctx,
 						   NRF_WIFI_FMAC_RX_CMD_TYPE_INIT,
@@ -186,6 +224,16 @@ static enum nrf_wifi_status nrf_wifi_sys_fmac_deinit_rx(struct nrf_wifi_fmac_dev
 		}
 	}
 
+#ifdef NRF70_RX_BUF_RECYCLE
+	nrf_wifi_fmac_rx_buf_free_list_deinit(fmac_dev_ctx);
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	nrf_wifi_fmac_rx_refill_deinit(fmac_dev_ctx);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+	nrf_wifi_fmac_rx_desc_map_deinit(fmac_dev_ctx);
+
 	nrf_wifi_osal_data_mem_free(sys_dev_ctx->rx_buf_info);
 
 	sys_dev_ctx->rx_buf_info = NULL;
@@ -194,6 +242,65 @@ out:
 }
 
 
+static enum nrf_wifi_status nrf_wifi_sys_fmac_umac_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							struct nrf_wifi_phy_rf_params *rf_params,
+							bool rf_params_valid,
+#ifdef NRF_WIFI_LOW_POWER
+							int sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+							unsigned int phy_calib,
+							enum op_band op_band,
+							bool beamforming,
+							struct nrf_wifi_tx_pwr_ctrl_params *tx_pwr_ctrl,
+							struct nrf_wifi_board_params *board_params,
+							unsigned char *country_code)
+{
+	unsigned long start_time_us = 0;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	status = umac_cmd_sys_init(fmac_dev_ctx,
+				   rf_params,
+				   rf_params_valid,
+				   &sys_fpriv->data_config,
+#ifdef NRF_WIFI_LOW_POWER
+				   sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+				   phy_calib,
+				   op_band,
+				   beamforming,
+				   tx_pwr_ctrl,
+				   board_params,
+				   country_code);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: UMAC init failed",
+				      __func__);
+		goto out;
+	}
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+	while (!fmac_dev_ctx->fw_init_done) {
+		nrf_wifi_osal_sleep_ms(1);
+#define MAX_INIT_WAIT (5 * 1000 * 1000)
+		if (nrf_wifi_osal_time_elapsed_us(start_time_us) >= MAX_INIT_WAIT) {
+			break;
+		}
+	}
+
+	if (!fmac_dev_ctx->fw_init_done) {
+		nrf_wifi_osal_log_err("%s: UMAC init timed out",
+				      __func__);
+		status = NRF_WIFI_STATUS_FAIL;
+		goto out;
+	}
+out:
+	return status;
+}
+
+
 static enum nrf_wifi_status nrf_wifi_sys_fmac_fw_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						      struct nrf_wifi_phy_rf_params *rf_params,
 						      bool rf_params_valid,
@@ -207,16 +314,15 @@ static enum nrf_wifi_status nrf_wifi_sys_fmac_fw_init(struct nrf_wifi_fmac_dev_c
 						      struct nrf_wifi_board_params *board_params,
 						      unsigned char *country_code)
 {
-	unsigned long start_time_us = 0;
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 	struct nrf_wifi_rx_buf *rx_buf_ipc = NULL, *rx_buf_info_iter = NULL;
 	unsigned int desc_id = 0;
 	unsigned int buf_addr = 0;
-#endif /*NRF_WIFI_RX_BUFF_PROG_UMAC */
 
 	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+#endif /*NRF_WIFI_RX_BUFF_PROG_UMAC */
 
 #ifdef NRF70_DATA_TX
 	status = nrf_wifi_sys_fmac_init_tx(fmac_dev_ctx);
@@ -239,46 +345,24 @@ static enum nrf_wifi_status nrf_wifi_sys_fmac_fw_init(struct nrf_wifi_fmac_dev_c
 		goto out;
 	}
 
-	status = umac_cmd_sys_init(fmac_dev_ctx,
-				   rf_params,
-				   rf_params_valid,
-				   &sys_fpriv->data_config,
+	status = nrf_wifi_sys_fmac_umac_init(fmac_dev_ctx,
+					     rf_params,
+					     rf_params_valid,
 #ifdef NRF_WIFI_LOW_POWER
-				   sleep_type,
+					     sleep_type,
 #endif /* NRF_WIFI_LOW_POWER */
-				   phy_calib,
-				   op_band,
-				   beamforming,
-				   tx_pwr_ctrl,
-				   board_params,
-				   country_code);
+					     phy_calib,
+					     op_band,
+					     beamforming,
+					     tx_pwr_ctrl,
+					     board_params,
+					     country_code);
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: UMAC init failed",
-				      __func__);
-		nrf_wifi_sys_fmac_deinit_rx(fmac_dev_ctx);
-#ifdef NRF70_DATA_TX
-		nrf_wifi_sys_fmac_deinit_tx(fmac_dev_ctx);
-#endif /* NRF70_DATA_TX */
-		goto out;
-	}
-	start_time_us = nrf_wifi_osal_time_get_curr_us();
-	while (!fmac_dev_ctx->fw_init_done) {
-		nrf_wifi_osal_sleep_ms(1);
-#define MAX_INIT_WAIT (5 * 1000 * 1000)
-		if (nrf_wifi_osal_time_elapsed_us(start_time_us) >= MAX_INIT_WAIT) {
-			break;
-		}
-	}
-
-	if (!fmac_dev_ctx->fw_init_done) {
-		nrf_wifi_osal_log_err("%s: UMAC init timed out",
-				      __func__);
 		nrf_wifi_sys_fmac_deinit_rx(fmac_dev_ctx);
 #ifdef NRF70_DATA_TX
 		nrf_wifi_sys_fmac_deinit_tx(fmac_dev_ctx);
 #endif /* NRF70_DATA_TX */
-		status = NRF_WIFI_STATUS_FAIL;
 		goto out;
 	}
 
@@ -438,6 +522,12 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fm
 		struct nrf_wifi_fmac_otp_info otp_info;
 #endif /* !NRF71_ON_IPC */
 	struct nrf_wifi_phy_rf_params phy_rf_params;
+#if defined(NRF_WIFI_RPU_FAST_RECOVERY) || defined(NRF_WIFI_SCAN_CACHE)
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY || NRF_WIFI_SCAN_CACHE */
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	struct nrf_wifi_fmac_recovery_info *recovery = NULL;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 
 	if (!fmac_dev_ctx) {
 		nrf_wifi_osal_log_err("%s: Invalid device context",
@@ -451,6 +541,53 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fm
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	/* Keep the init parameters to bring the RPU back up on a fast recovery */
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	recovery = &sys_dev_ctx->recovery;
+#ifdef NRF_WIFI_LOW_POWER
+	recovery->sleep_type = sleep_type;
+#endif /* NRF_WIFI_LOW_POWER */
+	recovery->phy_calib = phy_calib;
+	recovery->op_band = op_band;
+	recovery->beamforming = beamforming;
+
+	if (tx_pwr_ctrl_params) {
+		nrf_wifi_osal_mem_cpy(&recovery->tx_pwr_ctrl,
+				      tx_pwr_ctrl_params,
+				      sizeof(recovery->tx_pwr_ctrl));
+	}
+
+	if (board_params) {
+		nrf_wifi_osal_mem_cpy(&recovery->board_params,
+				      board_params,
+				      sizeof(recovery->board_params));
+	}
+
+	if (country_code) {
+		nrf_wifi_osal_mem_cpy(recovery->country_code,
+				      country_code,
+				      sizeof(recovery->country_code));
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+#ifdef NRF_WIFI_SCAN_CACHE
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->bss_cache.lock) {
+		sys_dev_ctx->bss_cache.lock = nrf_wifi_osal_spinlock_alloc();
+
+		if (!sys_dev_ctx->bss_cache.lock) {
+			nrf_wifi_osal_log_err("%s: Unable to allocate scan result cache lock",
+					      __func__);
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+
+		nrf_wifi_osal_spinlock_init(sys_dev_ctx->bss_cache.lock);
+	}
+
+#endif /* NRF_WIFI_SCAN_CACHE */
 #ifndef NRF71_ON_IPC
 	fmac_dev_ctx->tx_pwr_ceil_params = nrf_wifi_osal_mem_alloc(sizeof(*tx_pwr_ceil_params));
 	nrf_wifi_osal_mem_cpy(fmac_dev_ctx->tx_pwr_ceil_params,
@@ -533,6 +670,10 @@ enum nrf_wifi_status nrf_wifi_coex_config_sleep_ctrl_gpio_ctrl(
 
 void nrf_wifi_sys_fmac_dev_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 {
+#ifdef NRF_WIFI_SCAN_CACHE
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+#endif /* NRF_WIFI_SCAN_CACHE */
 	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
 		nrf_wifi_osal_log_err("%s: Invalid op mode",
 				      __func__);
@@ -542,6 +683,17 @@ void nrf_wifi_sys_fmac_dev_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 	nrf_wifi_hal_dev_deinit(fmac_dev_ctx->hal_dev_ctx);
 	nrf_wifi_sys_fmac_fw_deinit(fmac_dev_ctx);
 	nrf_wifi_osal_mem_free(fmac_dev_ctx->tx_pwr_ceil_params);
+#ifdef NRF_WIFI_SCAN_CACHE
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (sys_dev_ctx->bss_cache.lock) {
+		nrf_wifi_osal_spinlock_free(sys_dev_ctx->bss_cache.lock);
+		nrf_wifi_osal_mem_set(&sys_dev_ctx->bss_cache,
+				      0,
+				      sizeof(sys_dev_ctx->bss_cache));
+	}
+#endif /* NRF_WIFI_SCAN_CACHE */
 }
 
 #ifdef NRF_WIFI_RPU_RECOVERY
@@ -687,6 +839,72 @@ out:
 }
 
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+/* Called with the HAL lock held once the scan command has been posted to
+ * the RPU or dropped. A dropped scan will never be reported done by the
+ * RPU, so report it as aborted to the OS.
+ */
+static void nrf_wifi_fmac_scan_cmd_callbk_fn(void *callbk_data,
+					     enum nrf_wifi_status status)
+{
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = callbk_data;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_umac_event_trigger_scan scan_abort_event;
+	unsigned char if_idx = 0;
+
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		return;
+	}
+
+	fmac_dev_ctx = vif_ctx->fmac_dev_ctx;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	for (if_idx = 0; if_idx < MAX_NUM_VIFS; if_idx++) {
+		if (sys_dev_ctx->vif_ctx[if_idx] == vif_ctx) {
+			break;
+		}
+	}
+
+	nrf_wifi_osal_log_err("%s: Scan command for VIF %d dropped",
+			      __func__,
+			      if_idx);
+
+	if ((if_idx == MAX_NUM_VIFS) || !sys_fpriv->callbk_fns.scan_abort_callbk_fn) {
+		return;
+	}
+
+	nrf_wifi_osal_mem_set(&scan_abort_event,
+			      0,
+			      sizeof(scan_abort_event));
+
+	scan_abort_event.umac_hdr.cmd_evnt = NRF_WIFI_UMAC_EVENT_SCAN_ABORTED;
+	scan_abort_event.umac_hdr.ids.wdev_id = if_idx;
+	scan_abort_event.umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+
+	sys_fpriv->callbk_fns.scan_abort_callbk_fn(vif_ctx->os_vif_ctx,
+						   &scan_abort_event,
+						   sizeof(scan_abort_event));
+}
+
+
+/* Called with the HAL lock held once the key command has been posted to
+ * the RPU or dropped.
+ */
+static void nrf_wifi_fmac_key_cmd_callbk_fn(void *callbk_data,
+					    enum nrf_wifi_status status)
+{
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Key command for key index %d dropped",
+				      __func__,
+				      (int)(unsigned long)callbk_data);
+	}
+}
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+
 enum nrf_wifi_status nrf_wifi_sys_fmac_scan(void *dev_ctx,
 					    unsigned char if_idx,
 					    struct nrf_wifi_umac_scan_info *scan_info)
@@ -724,9 +942,20 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_scan(void *dev_ctx,
 			      scan_info,
 			      (sizeof(scan_cmd->info) + channel_info_len));
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	/* Scans do not wait for a free RPU command buffer, a dropped scan
+	 * is reported to the OS as aborted.
+	 */
+	status = umac_cmd_cfg_async(fmac_dev_ctx,
+				    scan_cmd,
+				    sizeof(*scan_cmd) + channel_info_len,
+				    nrf_wifi_fmac_scan_cmd_callbk_fn,
+				    sys_dev_ctx->vif_ctx[if_idx]);
+#else
 	status = umac_cmd_cfg(fmac_dev_ctx,
 			      scan_cmd,
 			      sizeof(*scan_cmd) + channel_info_len);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 out:
 	if (scan_cmd) {
 		nrf_wifi_osal_mem_free(scan_cmd);
@@ -965,6 +1194,11 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_assoc(void *dev_ctx,
 	nrf_wifi_osal_mem_cpy(vif_ctx->bssid,
 			      assoc_info->nrf_wifi_bssid,
 			      NRF_WIFI_ETH_ADDR_LEN);
+#ifdef NRF70_TX_FLOW_CACHE
+
+	/* Station frames are classified using the BSSID */
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 
 	assoc_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*assoc_cmd));
 
@@ -1177,9 +1411,20 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_add_key(void *dev_ctx,
 	key_cmd->key_info.valid_fields |= NRF_WIFI_CIPHER_SUITE_VALID;
 	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_TYPE_VALID;
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	/* The key is installed once the RPU takes the command, commands are
+	 * posted in order so it is in place before any later command.
+	 */
+	status = umac_cmd_cfg_async(fmac_dev_ctx,
+				    key_cmd,
+				    sizeof(*key_cmd),
+				    nrf_wifi_fmac_key_cmd_callbk_fn,
+				    (void *)(unsigned long)key_info->key_idx);
+#else
 	status = umac_cmd_cfg(fmac_dev_ctx,
 			      key_cmd,
 			      sizeof(*key_cmd));
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 
 out:
 	if (key_cmd) {
@@ -2121,6 +2366,34 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_mac_addr(struct nrf_wifi_fmac_dev_ctx *fm
 }
 
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+static void nrf_wifi_fmac_vif_recovery_info_free(struct nrf_wifi_fmac_vif_ctx *vif_ctx)
+{
+	struct nrf_wifi_fmac_vif_recovery_info *recovery = &vif_ctx->recovery;
+
+	if (recovery->add_vif_cmd) {
+		nrf_wifi_osal_mem_free(recovery->add_vif_cmd);
+	}
+
+	if (recovery->chg_vif_cmd) {
+		nrf_wifi_osal_mem_free(recovery->chg_vif_cmd);
+	}
+
+	if (recovery->macaddr_cmd) {
+		nrf_wifi_osal_mem_free(recovery->macaddr_cmd);
+	}
+
+	if (recovery->chg_vif_state_cmd) {
+		nrf_wifi_osal_mem_free(recovery->chg_vif_state_cmd);
+	}
+
+	nrf_wifi_osal_mem_set(recovery,
+			      0,
+			      sizeof(*recovery));
+}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+
 unsigned char nrf_wifi_sys_fmac_add_vif(void *dev_ctx,
 					void *os_vif_ctx,
 					struct nrf_wifi_umac_add_vif_info *vif_info)
@@ -2229,12 +2502,20 @@ unsigned char nrf_wifi_sys_fmac_add_vif(void *dev_ctx,
 			goto err;
 		}
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		vif_ctx->recovery.add_vif_cmd = add_vif_cmd;
+		add_vif_cmd = NULL;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 	}
 
 	sys_dev_ctx->vif_ctx[vif_idx] = vif_ctx;
 
 	nrf_wifi_fmac_vif_incr_if_type(fmac_dev_ctx,
 				       vif_ctx->if_type);
+#ifdef NRF70_TX_FLOW_CACHE
+
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 
 	goto out;
 err:
@@ -2323,6 +2604,10 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_del_vif(void *dev_ctx,
 	}
 
 	nrf_wifi_fmac_vif_decr_if_type(fmac_dev_ctx, vif_ctx->if_type);
+#ifdef NRF70_TX_FLOW_CACHE
+
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 
 out:
 	if (del_vif_cmd) {
@@ -2330,6 +2615,9 @@ out:
 	}
 
 	if (vif_ctx) {
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		nrf_wifi_fmac_vif_recovery_info_free(vif_ctx);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 		nrf_wifi_osal_mem_free(vif_ctx);
 	}
 
@@ -2391,6 +2679,23 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_chg_vif(void *dev_ctx,
 	status = umac_cmd_cfg(fmac_dev_ctx,
 			      chg_vif_cmd,
 			      sizeof(*chg_vif_cmd));
+
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+		struct nrf_wifi_fmac_vif_recovery_info *recovery = NULL;
+
+		sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+		recovery = &sys_dev_ctx->vif_ctx[if_idx]->recovery;
+
+		if (recovery->chg_vif_cmd) {
+			nrf_wifi_osal_mem_free(recovery->chg_vif_cmd);
+		}
+
+		recovery->chg_vif_cmd = chg_vif_cmd;
+		chg_vif_cmd = NULL;
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 out:
 	if (chg_vif_cmd) {
 		nrf_wifi_osal_mem_free(chg_vif_cmd);
@@ -2406,6 +2711,10 @@ out:
 						 vif_info->iftype);
 
 		sys_dev_ctx->vif_ctx[if_idx]->if_type = vif_info->iftype;
+#ifdef NRF70_TX_FLOW_CACHE
+
+		nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 	}
 
 	return status;
@@ -2479,6 +2788,14 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_chg_vif_state(void *dev_ctx,
 		}
 	}
 #endif /* NRF70_AP_MODE */
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	if (vif_ctx->recovery.chg_vif_state_cmd) {
+		nrf_wifi_osal_mem_free(vif_ctx->recovery.chg_vif_state_cmd);
+	}
+
+	vif_ctx->recovery.chg_vif_state_cmd = chg_vif_state_cmd;
+	chg_vif_state_cmd = NULL;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 out:
 	if (chg_vif_state_cmd) {
 		nrf_wifi_osal_mem_free(chg_vif_state_cmd);
@@ -2495,6 +2812,10 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_vif_macaddr(void *dev_ctx,
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
 	struct nrf_wifi_umac_cmd_change_macaddr *cmd = NULL;
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 
 	if (!dev_ctx) {
 		goto out;
@@ -2533,6 +2854,20 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_vif_macaddr(void *dev_ctx,
 	status = umac_cmd_cfg(fmac_dev_ctx,
 			      cmd,
 			      sizeof(*cmd));
+
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	if ((status == NRF_WIFI_STATUS_SUCCESS) && vif_ctx) {
+		if (vif_ctx->recovery.macaddr_cmd) {
+			nrf_wifi_osal_mem_free(vif_ctx->recovery.macaddr_cmd);
+		}
+
+		vif_ctx->recovery.macaddr_cmd = cmd;
+		cmd = NULL;
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 out:
 	if (cmd) {
 		nrf_wifi_osal_mem_free(cmd);
@@ -2854,6 +3189,12 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_qos_map(void *dev_ctx,
 	status = umac_cmd_cfg(fmac_dev_ctx,
 			      set_qos_cmd,
 			      sizeof(*set_qos_cmd));
+#ifdef NRF70_TX_FLOW_CACHE
+
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+	}
+#endif /* NRF70_TX_FLOW_CACHE */
 out:
 	if (set_qos_cmd) {
 		nrf_wifi_osal_mem_free(set_qos_cmd);
@@ -3457,6 +3798,827 @@ out:
 	return status;
 }
 
+#ifdef NRF70_TX_LATENCY_STATS
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_lat_stats_get(void *dev_ctx,
+							struct nrf_wifi_tx_lat_stats *stats,
+							bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->tx_config.tx_lock) {
+		nrf_wifi_osal_log_err("%s: TX path not initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &sys_dev_ctx->tx_config.lat_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&sys_dev_ctx->tx_config.lat_stats,
+				      0,
+				      sizeof(sys_dev_ctx->tx_config.lat_stats));
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_TX_LATENCY_STATS */
+
+#ifdef NRF70_TX_AQM
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_aqm_stats_get(void *dev_ctx,
+							unsigned int peer_id,
+							unsigned int ac,
+							struct nrf_wifi_tx_aqm_stats *stats,
+							bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats ||
+	    (peer_id >= MAX_SW_PEERS) ||
+	    (ac >= NRF_WIFI_FMAC_AC_MAX)) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->tx_config.tx_lock) {
+		nrf_wifi_osal_log_err("%s: TX path not initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &sys_dev_ctx->tx_config.aqm_stats[peer_id][ac],
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&sys_dev_ctx->tx_config.aqm_stats[peer_id][ac],
+				      0,
+				      sizeof(*stats));
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_TX_AQM */
+
+#ifdef NRF70_RX_BUF_RECYCLE
+enum nrf_wifi_status nrf_wifi_sys_fmac_rx_buf_recycle(void *dev_ctx,
+						      void *nwb)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned int buf_sz = 0;
+	unsigned int pool_buf_sz = 0;
+	unsigned int best_buf_sz = 0;
+	int best_pool_id = -1;
+	int pool_id = 0;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !nwb) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	if (!sys_dev_ctx->rx_buf_free_list_lock) {
+		nrf_wifi_osal_nbuf_free(nwb);
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+
+	buf_sz = nrf_wifi_osal_nbuf_reset(nwb);
+
+	/* Use the pool with the largest buffers that still fit */
+	for (pool_id = 0; pool_id < MAX_NUM_OF_RX_QUEUES; pool_id++) {
+		if (!sys_dev_ctx->rx_buf_free_list[pool_id].max_bufs) {
+			continue;
+		}
+
+		pool_buf_sz = sys_fpriv->rx_buf_pools[pool_id].buf_sz + RX_BUF_HEADROOM;
+
+		if ((pool_buf_sz <= buf_sz) && (pool_buf_sz > best_buf_sz)) {
+			best_buf_sz = pool_buf_sz;
+			best_pool_id = pool_id;
+		}
+	}
+
+	if (best_pool_id < 0) {
+		nrf_wifi_osal_nbuf_free(nwb);
+	} else {
+		nrf_wifi_fmac_rx_buf_put(fmac_dev_ctx,
+					 best_pool_id,
+					 nwb);
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_event_handler_register(void *dev_ctx,
+							      unsigned int event_num,
+							      nrf_wifi_umac_event_handler_t handler,
+							      unsigned int min_len)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_umac_event_desc *desc = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx ||
+	    (event_num < NRF_WIFI_UMAC_EVENT_UNSPECIFIED) ||
+	    (event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED >= NRF_WIFI_UMAC_EVENT_NUM)) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	desc = &sys_dev_ctx->umac_event_handlers[event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED];
+
+	desc->min_len = min_len;
+	desc->handler = handler;
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_event_stats_get(void *dev_ctx,
+						       unsigned int event_num,
+						       struct nrf_wifi_umac_event_stats *stats,
+						       bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_umac_event_stats *event_stats = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats ||
+	    (event_num < NRF_WIFI_UMAC_EVENT_UNSPECIFIED) ||
+	    (event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED >= NRF_WIFI_UMAC_EVENT_NUM)) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	event_stats = &sys_dev_ctx->umac_event_stats[event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED];
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      event_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(event_stats,
+				      0,
+				      sizeof(*event_stats));
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_telemetry_get(void *dev_ctx,
+								  struct nrf_wifi_hal_rpu_recovery_telemetry *telemetry,
+								  bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !telemetry) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_hal_rpu_recovery_telemetry_get(fmac_dev_ctx->hal_dev_ctx,
+							 telemetry,
+							 reset);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+#ifdef NRF70_RAW_RX_BATCH
+enum nrf_wifi_status nrf_wifi_sys_fmac_raw_rx_batch_stats_get(void *dev_ctx,
+							      struct nrf_wifi_fmac_raw_rx_batch_stats *stats,
+							      bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	/* The statistics are updated from the RX path */
+	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &sys_dev_ctx->raw_rx_batch.stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&sys_dev_ctx->raw_rx_batch.stats,
+				      0,
+				      sizeof(sys_dev_ctx->raw_rx_batch.stats));
+	}
+
+	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_RAW_RX_BATCH */
+
+#ifdef NRF_WIFI_SCAN_CACHE
+static struct nrf_wifi_fmac_bss_cache *bss_cache_get(void *dev_ctx,
+						     const char *caller)
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      caller);
+		return NULL;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      caller);
+		return NULL;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->bss_cache.lock) {
+		nrf_wifi_osal_log_err("%s: Scan result cache not initialized",
+				      caller);
+		return NULL;
+	}
+
+	return &sys_dev_ctx->bss_cache;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_get(void *dev_ctx,
+						     struct nrf_wifi_fmac_bss_cache_entry *entries,
+						     unsigned int max_entries,
+						     unsigned int *num_entries)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_bss_cache *bss_cache = NULL;
+	struct nrf_wifi_fmac_bss_cache_slot *slot = NULL;
+	unsigned long now_ms = 0;
+	unsigned int age_ms = 0;
+	unsigned int i = 0;
+
+	if (!entries || !num_entries) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	bss_cache = bss_cache_get(dev_ctx,
+				  __func__);
+
+	if (!bss_cache) {
+		goto out;
+	}
+
+	*num_entries = 0;
+	now_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	nrf_wifi_osal_spinlock_take(bss_cache->lock);
+
+	for (i = 0; i < NRF_WIFI_FMAC_BSS_CACHE_SIZE; i++) {
+		slot = &bss_cache->slots[i];
+
+		if (!slot->valid) {
+			continue;
+		}
+
+		age_ms = now_ms - slot->last_seen_ms;
+
+		if (age_ms >= NRF_WIFI_FMAC_BSS_CACHE_AGE_MS) {
+			slot->valid = false;
+			bss_cache->stats.num_entries--;
+			bss_cache->stats.num_aged++;
+			continue;
+		}
+
+		if (*num_entries == max_entries) {
+			continue;
+		}
+
+		nrf_wifi_osal_mem_cpy(&entries[*num_entries].res,
+				      &slot->res,
+				      sizeof(entries[*num_entries].res));
+		entries[*num_entries].age_ms = age_ms;
+		entries[*num_entries].num_seen = slot->num_seen;
+		(*num_entries)++;
+	}
+
+	nrf_wifi_osal_spinlock_rel(bss_cache->lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_flush(void *dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_bss_cache *bss_cache = NULL;
+
+	bss_cache = bss_cache_get(dev_ctx,
+				  __func__);
+
+	if (!bss_cache) {
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(bss_cache->lock);
+
+	nrf_wifi_osal_mem_set(bss_cache->slots,
+			      0,
+			      sizeof(bss_cache->slots));
+	bss_cache->stats.num_entries = 0;
+
+	nrf_wifi_osal_spinlock_rel(bss_cache->lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_stats_get(void *dev_ctx,
+							   struct nrf_wifi_fmac_bss_cache_stats *stats,
+							   bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_bss_cache *bss_cache = NULL;
+	unsigned int num_entries = 0;
+
+	if (!stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	bss_cache = bss_cache_get(dev_ctx,
+				  __func__);
+
+	if (!bss_cache) {
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(bss_cache->lock);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &bss_cache->stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		num_entries = bss_cache->stats.num_entries;
+		nrf_wifi_osal_mem_set(&bss_cache->stats,
+				      0,
+				      sizeof(bss_cache->stats));
+		bss_cache->stats.num_entries = num_entries;
+	}
+
+	nrf_wifi_osal_spinlock_rel(bss_cache->lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_SCAN_CACHE */
+
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+static enum nrf_wifi_status nrf_wifi_fmac_vif_recovery_replay(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							      struct nrf_wifi_fmac_vif_ctx *vif_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
+	struct nrf_wifi_fmac_vif_recovery_info *recovery = &vif_ctx->recovery;
+	unsigned int count = RPU_CMD_TIMEOUT_MS;
+
+	if (recovery->add_vif_cmd) {
+		status = umac_cmd_cfg(fmac_dev_ctx,
+				      recovery->add_vif_cmd,
+				      sizeof(*recovery->add_vif_cmd));
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+
+	if (recovery->chg_vif_cmd) {
+		status = umac_cmd_cfg(fmac_dev_ctx,
+				      recovery->chg_vif_cmd,
+				      sizeof(*recovery->chg_vif_cmd));
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+
+	if (recovery->macaddr_cmd) {
+		status = umac_cmd_cfg(fmac_dev_ctx,
+				      recovery->macaddr_cmd,
+				      sizeof(*recovery->macaddr_cmd));
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+
+	if (recovery->chg_vif_state_cmd) {
+		vif_ctx->ifflags = false;
+
+		status = umac_cmd_cfg(fmac_dev_ctx,
+				      recovery->chg_vif_state_cmd,
+				      sizeof(*recovery->chg_vif_state_cmd));
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+
+		while (!vif_ctx->ifflags && (--count > 0))
+			nrf_wifi_osal_sleep_ms(1);
+
+		if (count == 0) {
+			nrf_wifi_osal_log_err("%s: RPU is unresponsive for %d sec",
+					      __func__, RPU_CMD_TIMEOUT_MS / 1000);
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+	}
+out:
+	return status;
+}
+
+
+#ifdef NRF70_STA_MODE
+/* The restarted RPU has no connections: report a deauthentication from each
+ * peer of the VIF to the OS, so that the upper layers reconnect, and forget
+ * the peers.
+ */
+static void nrf_wifi_fmac_vif_recovery_disconnect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						  unsigned char if_idx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct nrf_wifi_umac_event_mlme *deauth_event = NULL;
+	struct peers_info *peer = NULL;
+	unsigned char *frame = NULL;
+	unsigned int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	for (i = 0; i < MAX_PEERS; i++) {
+		peer = &sys_dev_ctx->tx_config.peers[i];
+
+		if ((peer->peer_id == -1) || (peer->if_idx != if_idx)) {
+			continue;
+		}
+
+		if (!sys_fpriv->callbk_fns.deauth_callbk_fn) {
+			break;
+		}
+
+		if (!deauth_event) {
+			deauth_event = nrf_wifi_osal_mem_alloc(sizeof(*deauth_event));
+
+			if (!deauth_event) {
+				nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+						      __func__);
+				break;
+			}
+		}
+
+		nrf_wifi_osal_mem_set(deauth_event,
+				      0,
+				      sizeof(*deauth_event));
+
+		deauth_event->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_EVENT_DEAUTHENTICATE;
+		deauth_event->umac_hdr.ids.wdev_id = if_idx;
+		deauth_event->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+
+		nrf_wifi_osal_mem_cpy(deauth_event->mac_addr,
+				      (vif_ctx->if_type == NRF_WIFI_IFTYPE_AP) ?
+				      (unsigned char *)vif_ctx->mac_addr : peer->ra_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+
+		/* Deauthentication frame from the peer to the VIF */
+		frame = (unsigned char *)deauth_event->frame.frame;
+		frame[0] = NRF_WIFI_FMAC_FTYPE_MGMT | NRF_WIFI_FMAC_STYPE_DEAUTH;
+		nrf_wifi_osal_mem_cpy(&frame[4],
+				      vif_ctx->mac_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+		nrf_wifi_osal_mem_cpy(&frame[10],
+				      peer->ra_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+		nrf_wifi_osal_mem_cpy(&frame[16],
+				      deauth_event->mac_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+		frame[NRF_WIFI_FMAC_MGMT_HDR_LEN] = NRF_WIFI_FMAC_REASON_UNSPECIFIED;
+		deauth_event->frame.frame_len = NRF_WIFI_FMAC_MGMT_HDR_LEN + 2;
+
+		sys_fpriv->callbk_fns.deauth_callbk_fn(vif_ctx->os_vif_ctx,
+						       deauth_event,
+						       sizeof(*deauth_event));
+	}
+
+	if (deauth_event) {
+		nrf_wifi_osal_mem_free(deauth_event);
+	}
+
+	nrf_wifi_fmac_peers_flush(fmac_dev_ctx, if_idx);
+}
+#endif /* NRF70_STA_MODE */
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_fast_recovery(void *dev_ctx,
+						     struct nrf_wifi_fmac_fw_info *fw_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_recovery_info *recovery = NULL;
+	struct nrf_wifi_phy_rf_params phy_rf_params;
+	unsigned long start_time_us = 0;
+	unsigned char i = 0;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !fw_info) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	recovery = &sys_dev_ctx->recovery;
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+#ifdef NRF70_DATA_TX
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+	recovery->in_progress = true;
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#else
+	recovery->in_progress = true;
+#endif /* NRF70_DATA_TX */
+
+	nrf_wifi_hal_dev_deinit(fmac_dev_ctx->hal_dev_ctx);
+
+#ifdef NRF70_DATA_TX
+	recovery->num_requeued_frames += tx_recovery_requeue(fmac_dev_ctx);
+#endif /* NRF70_DATA_TX */
+
+	status = nrf_wifi_sys_fmac_deinit_rx(fmac_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Deinit RX failed",
+				      __func__);
+		goto out;
+	}
+
+	fmac_dev_ctx->fw_boot_done = false;
+	fmac_dev_ctx->fw_init_done = false;
+
+#ifndef NRF71_ON_IPC
+	status = nrf_wifi_fmac_fw_load(fmac_dev_ctx,
+				       fw_info);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: FW load failed",
+				      __func__);
+		goto out;
+	}
+#endif /* !NRF71_ON_IPC */
+
+	status = nrf_wifi_hal_dev_init(fmac_dev_ctx->hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: nrf_wifi_hal_dev_init failed",
+				      __func__);
+		goto out;
+	}
+
+#ifndef NRF71_ON_IPC
+	status = nrf_wifi_sys_fmac_rf_params_get(fmac_dev_ctx,
+						 &phy_rf_params);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RF parameters get failed",
+				      __func__);
+		goto out;
+	}
+#endif /* !NRF71_ON_IPC */
+
+	status = nrf_wifi_sys_fmac_init_rx(fmac_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Init RX failed",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_sys_fmac_umac_init(fmac_dev_ctx,
+					     &phy_rf_params,
+					     true,
+#ifdef NRF_WIFI_LOW_POWER
+					     recovery->sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+					     recovery->phy_calib,
+					     recovery->op_band,
+					     recovery->beamforming,
+					     &recovery->tx_pwr_ctrl,
+					     &recovery->board_params,
+					     recovery->country_code);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		goto out;
+	}
+
+	for (i = 0; i < MAX_NUM_VIFS; i++) {
+		if (!sys_dev_ctx->vif_ctx[i]) {
+			continue;
+		}
+
+		status = nrf_wifi_fmac_vif_recovery_replay(fmac_dev_ctx,
+							   sys_dev_ctx->vif_ctx[i]);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: VIF %d replay failed",
+					      __func__,
+					      i);
+			goto out;
+		}
+
+#ifdef NRF70_STA_MODE
+		nrf_wifi_fmac_vif_recovery_disconnect(fmac_dev_ctx, i);
+#endif /* NRF70_STA_MODE */
+	}
+
+#ifdef NRF70_DATA_TX
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+	recovery->in_progress = false;
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	tx_recovery_resume(fmac_dev_ctx);
+#else
+	recovery->in_progress = false;
+#endif /* NRF70_DATA_TX */
+
+	recovery->num_recoveries++;
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+	nrf_wifi_hal_rpu_recovery_done(fmac_dev_ctx->hal_dev_ctx);
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+	nrf_wifi_osal_log_info("%s: RPU recovered in %u us",
+			       __func__,
+			       nrf_wifi_osal_time_elapsed_us(start_time_us));
+out:
+	if (recovery && (status != NRF_WIFI_STATUS_SUCCESS)) {
+		recovery->num_failures++;
+
+		/* The fast recovery is over, hand the RPU over to the full
+		 * recovery by the OS.
+		 */
+#ifdef NRF70_DATA_TX
+		nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+		recovery->in_progress = false;
+		nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#else
+		recovery->in_progress = false;
+#endif /* NRF70_DATA_TX */
+
+#ifdef NRF_WIFI_RPU_RECOVERY
+		nrf_wifi_sys_fmac_rpu_recovery_callback(fmac_dev_ctx,
+							NULL,
+							0);
+#endif /* NRF_WIFI_RPU_RECOVERY */
+	}
+
+	return status;
+}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
 #ifndef NRF71_ON_IPC
 static int nrf_wifi_sys_fmac_phy_rf_params_init(struct nrf_wifi_phy_rf_params *prf,
 						unsigned int package_info,
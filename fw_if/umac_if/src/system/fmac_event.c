@@ -10,6 +10,8 @@
  * for the FMAC IF Layer of the Wi-Fi driver.
  */
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_EVENT
+
 #include "queue.h"
 
 #ifdef NRF71_ON_IPC
@@ -24,6 +26,9 @@
 #include "system/fmac_ap.h"
 #include "system/fmac_event.h"
 #include "common/fmac_util.h"
+#ifdef NRF_WIFI_SCAN_CACHE
+#include "util.h"
+#endif /* NRF_WIFI_SCAN_CACHE */
 
 #ifdef NRF70_SYSTEM_WITH_RAW_MODES
 static enum nrf_wifi_status
@@ -508,6 +513,545 @@ static void umac_event_connect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 #endif /* NRF70_STA_MODE */
 
 
+/* Generate a handler which passes the event on to an OS callback. */
+#define UMAC_EVENT_CALLBK_HANDLER(name, callbk)					\
+static enum nrf_wifi_status umac_event_##name(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,	\
+					      struct nrf_wifi_fmac_vif_ctx *vif_ctx,	\
+					      void *event_data,				\
+					      unsigned int event_len)			\
+{										\
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;			\
+	struct nrf_wifi_fmac_callbk_fns *callbk_fns = NULL;			\
+										\
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);			\
+	callbk_fns = &sys_fpriv->callbk_fns;					\
+										\
+	if (!callbk_fns->callbk) {						\
+		nrf_wifi_osal_log_err("%s: No callback registered for event %d",\
+				      __func__,					\
+				      ((struct nrf_wifi_umac_hdr *)event_data)->cmd_evnt); \
+		return NRF_WIFI_STATUS_FAIL;					\
+	}									\
+										\
+	callbk_fns->callbk(vif_ctx->os_vif_ctx,					\
+			   event_data,						\
+			   event_len);						\
+										\
+	return NRF_WIFI_STATUS_SUCCESS;						\
+}
+
+UMAC_EVENT_CALLBK_HANDLER(get_reg, event_get_reg)
+UMAC_EVENT_CALLBK_HANDLER(reg_change, reg_change_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(scan_start, scan_start_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(scan_done, scan_done_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(scan_abort, scan_abort_callbk_fn)
+#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
+UMAC_EVENT_CALLBK_HANDLER(set_if, set_if_callbk_fn)
+#endif /* NRF70_STA_MODE || NRF70_RAW_DATA_RX */
+#ifdef NRF70_STA_MODE
+UMAC_EVENT_CALLBK_HANDLER(twt_sleep, twt_sleep_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(auth_resp, auth_resp_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(assoc_resp, assoc_resp_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(deauth, deauth_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(disassoc, disassoc_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(mgmt_rx, mgmt_rx_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(tx_pwr_get, tx_pwr_get_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(chnl_get, chnl_get_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(get_station, get_station_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(get_interface, get_interface_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(cookie_rsp, cookie_rsp_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(mgmt_tx_status, mgmt_tx_status)
+UMAC_EVENT_CALLBK_HANDLER(unprot_mlme_mgmt_rx, unprot_mlme_mgmt_rx_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(twt_config, twt_config_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(twt_teardown, twt_teardown_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(get_wiphy, event_get_wiphy)
+UMAC_EVENT_CALLBK_HANDLER(get_ps_info, event_get_ps_info)
+UMAC_EVENT_CALLBK_HANDLER(get_conn_info, get_conn_info_callbk_fn)
+#ifdef NRF70_P2P_MODE
+UMAC_EVENT_CALLBK_HANDLER(roc, roc_callbk_fn)
+UMAC_EVENT_CALLBK_HANDLER(roc_cancel, roc_cancel_callbk_fn)
+#endif /* NRF70_P2P_MODE */
+#endif /* NRF70_STA_MODE */
+
+
+#ifdef NRF_WIFI_SCAN_CACHE
+/* Called with the cache lock held */
+static struct nrf_wifi_fmac_bss_cache_slot *
+bss_cache_slot_get(struct nrf_wifi_fmac_bss_cache *bss_cache,
+		   unsigned char *bssid,
+		   unsigned long now_ms)
+{
+	struct nrf_wifi_fmac_bss_cache_slot *slot = NULL;
+	struct nrf_wifi_fmac_bss_cache_slot *free_slot = NULL;
+	struct nrf_wifi_fmac_bss_cache_slot *oldest_slot = NULL;
+	unsigned int i = 0;
+
+	for (i = 0; i < NRF_WIFI_FMAC_BSS_CACHE_SIZE; i++) {
+		slot = &bss_cache->slots[i];
+
+		if (slot->valid &&
+		    ((now_ms - slot->last_seen_ms) >= NRF_WIFI_FMAC_BSS_CACHE_AGE_MS)) {
+			slot->valid = false;
+			bss_cache->stats.num_entries--;
+			bss_cache->stats.num_aged++;
+		}
+
+		if (!slot->valid) {
+			if (!free_slot) {
+				free_slot = slot;
+			}
+			continue;
+		}
+
+		if (nrf_wifi_osal_mem_cmp(slot->res.mac_addr,
+					  bssid,
+					  NRF_WIFI_ETH_ADDR_LEN) == 0) {
+			bss_cache->stats.num_dups++;
+			return slot;
+		}
+
+		if (!oldest_slot || (slot->last_seen_ms < oldest_slot->last_seen_ms)) {
+			oldest_slot = slot;
+		}
+	}
+
+	if (free_slot) {
+		slot = free_slot;
+		bss_cache->stats.num_entries++;
+	} else {
+		slot = oldest_slot;
+		bss_cache->stats.num_evicted++;
+	}
+
+	nrf_wifi_osal_mem_set(slot,
+			      0,
+			      sizeof(*slot));
+	nrf_wifi_osal_mem_cpy(slot->res.mac_addr,
+			      bssid,
+			      NRF_WIFI_ETH_ADDR_LEN);
+	slot->valid = true;
+
+	return slot;
+}
+
+
+static void bss_cache_disp_res_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				      struct nrf_wifi_umac_event_new_scan_display_results *scan_res,
+				      unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *bss_cache = NULL;
+	struct nrf_wifi_fmac_bss_cache_slot *slot = NULL;
+	struct umac_display_results *res = NULL;
+	unsigned long now_ms = 0;
+	unsigned int hdr_len = 0;
+	unsigned int num_res = 0;
+	unsigned int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	bss_cache = &sys_dev_ctx->bss_cache;
+
+	if (!bss_cache->lock) {
+		return;
+	}
+
+	hdr_len = sizeof(*scan_res) - sizeof(scan_res->display_results);
+
+	if (event_len < hdr_len) {
+		return;
+	}
+
+	num_res = scan_res->event_bss_count;
+
+	if (num_res > DISPLAY_BSS_TOHOST_PEREVNT) {
+		num_res = DISPLAY_BSS_TOHOST_PEREVNT;
+	}
+
+	if (event_len < (hdr_len + (num_res * sizeof(*res)))) {
+		nrf_wifi_osal_log_err("%s: Truncated event (%d results, %d bytes)",
+				      __func__,
+				      num_res,
+				      event_len);
+		return;
+	}
+
+	now_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	nrf_wifi_osal_spinlock_take(bss_cache->lock);
+
+	for (i = 0; i < num_res; i++) {
+		res = &scan_res->display_results[i];
+
+		slot = bss_cache_slot_get(bss_cache,
+					  res->mac_addr,
+					  now_ms);
+
+		nrf_wifi_osal_mem_cpy(&slot->res,
+				      res,
+				      sizeof(slot->res));
+		slot->last_seen_ms = now_ms;
+		slot->num_seen++;
+		bss_cache->stats.num_results++;
+	}
+
+	nrf_wifi_osal_spinlock_rel(bss_cache->lock);
+}
+
+
+#ifdef NRF70_STA_MODE
+static void bss_cache_scan_res_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				      struct nrf_wifi_umac_event_new_scan_results *scan_res,
+				      unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *bss_cache = NULL;
+	struct nrf_wifi_fmac_bss_cache_slot *slot = NULL;
+	enum nrf_wifi_band band = NRF_WIFI_BAND_2GHZ;
+	unsigned char *ie = NULL;
+	unsigned char *ssid_ie = NULL;
+	unsigned int ies_len = 0;
+	unsigned long now_ms = 0;
+	int chan = -1;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	bss_cache = &sys_dev_ctx->bss_cache;
+
+	if (!bss_cache->lock) {
+		return;
+	}
+
+	if (event_len < sizeof(*scan_res)) {
+		return;
+	}
+
+	ies_len = scan_res->ies_len;
+
+	if (ies_len > (event_len - sizeof(*scan_res))) {
+		ies_len = event_len - sizeof(*scan_res);
+	}
+
+	/* Walk the IEs for the SSID (element ID 0) */
+	ie = scan_res->ies;
+
+	while ((ie + 2) <= (scan_res->ies + ies_len) &&
+	       (ie + 2 + ie[1]) <= (scan_res->ies + ies_len)) {
+		if ((ie[0] == 0) && (ie[1] <= NRF_WIFI_MAX_SSID_LEN)) {
+			ssid_ie = ie;
+			break;
+		}
+
+		ie += 2 + ie[1];
+	}
+
+	chan = nrf_wifi_utils_freq_to_chan(scan_res->frequency,
+					   &band);
+
+	now_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	nrf_wifi_osal_spinlock_take(bss_cache->lock);
+
+	slot = bss_cache_slot_get(bss_cache,
+				  scan_res->mac_addr,
+				  now_ms);
+
+	/* Security and protocol information is only reported by display
+	 * results, keep whatever is already cached for the BSS.
+	 */
+	if (ssid_ie) {
+		slot->res.ssid.nrf_wifi_ssid_len = ssid_ie[1];
+		nrf_wifi_osal_mem_cpy(slot->res.ssid.nrf_wifi_ssid,
+				      &ssid_ie[2],
+				      ssid_ie[1]);
+	}
+
+	if (chan > 0) {
+		slot->res.nwk_band = band;
+		slot->res.nwk_channel = chan;
+	}
+
+	slot->res.beacon_interval = scan_res->beacon_interval;
+	slot->res.capability = scan_res->capability;
+	nrf_wifi_osal_mem_cpy(&slot->res.signal,
+			      &scan_res->signal,
+			      sizeof(slot->res.signal));
+
+	if (scan_res->seen_ms_ago < (now_ms - slot->last_seen_ms)) {
+		slot->last_seen_ms = now_ms - scan_res->seen_ms_ago;
+	}
+
+	slot->num_seen++;
+	bss_cache->stats.num_results++;
+
+	nrf_wifi_osal_spinlock_rel(bss_cache->lock);
+}
+#endif /* NRF70_STA_MODE */
+#endif /* NRF_WIFI_SCAN_CACHE */
+
+
+static enum nrf_wifi_status umac_event_disp_scan_res(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						     struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+						     void *event_data,
+						     unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_callbk_fns *callbk_fns = NULL;
+	struct nrf_wifi_umac_hdr *umac_hdr = NULL;
+
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	callbk_fns = &sys_fpriv->callbk_fns;
+	umac_hdr = event_data;
+
+	if (!callbk_fns->disp_scan_res_callbk_fn) {
+		nrf_wifi_osal_log_err("%s: No callback registered for event %d",
+				      __func__,
+				      umac_hdr->cmd_evnt);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+#ifdef NRF_WIFI_SCAN_CACHE
+	bss_cache_disp_res_update(fmac_dev_ctx,
+				  event_data,
+				  event_len);
+
+#endif /* NRF_WIFI_SCAN_CACHE */
+	callbk_fns->disp_scan_res_callbk_fn(vif_ctx->os_vif_ctx,
+					    event_data,
+					    event_len,
+					    umac_hdr->seq != 0);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static enum nrf_wifi_status umac_event_ifflags_status(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+						      void *event_data,
+						      unsigned int event_len)
+{
+	struct nrf_wifi_umac_event_vif_state *evnt_vif_state = NULL;
+
+	evnt_vif_state = (struct nrf_wifi_umac_event_vif_state *)event_data;
+
+	if (evnt_vif_state->status < 0) {
+		nrf_wifi_osal_log_err("%s: Failed to set interface flags: %d",
+				      __func__,
+				      evnt_vif_state->status);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	vif_ctx->ifflags = true;
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+#ifdef NRF70_STA_MODE
+static enum nrf_wifi_status umac_event_scan_res(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+						void *event_data,
+						unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_callbk_fns *callbk_fns = NULL;
+	struct nrf_wifi_umac_hdr *umac_hdr = NULL;
+
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	callbk_fns = &sys_fpriv->callbk_fns;
+	umac_hdr = event_data;
+
+	if (!callbk_fns->scan_res_callbk_fn) {
+		nrf_wifi_osal_log_err("%s: No callback registered for event %d",
+				      __func__,
+				      umac_hdr->cmd_evnt);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+#ifdef NRF_WIFI_SCAN_CACHE
+	bss_cache_scan_res_update(fmac_dev_ctx,
+				  event_data,
+				  event_len);
+
+#endif /* NRF_WIFI_SCAN_CACHE */
+	callbk_fns->scan_res_callbk_fn(vif_ctx->os_vif_ctx,
+				       event_data,
+				       event_len,
+				       umac_hdr->seq != 0);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static enum nrf_wifi_status umac_event_cmd_status(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+						  void *event_data,
+						  unsigned int event_len)
+{
+#if WIFI_NRF70_LOG_LEVEL >= NRF_WIFI_LOG_LEVEL_DBG
+	struct nrf_wifi_umac_event_cmd_status *cmd_status =
+		(struct nrf_wifi_umac_event_cmd_status *)event_data;
+#endif
+	nrf_wifi_osal_log_dbg("%s: Command %d -> status %d",
+			      __func__,
+			      cmd_status->cmd_id,
+			      cmd_status->cmd_status);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static enum nrf_wifi_status umac_event_nop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+					   void *event_data,
+					   unsigned int event_len)
+{
+	/* Nothing to be done */
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static enum nrf_wifi_status umac_event_station(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					       struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+					       void *event_data,
+					       unsigned int event_len)
+{
+	umac_event_connect(fmac_dev_ctx,
+			   event_data);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+#endif /* NRF70_STA_MODE */
+
+
+#define UMAC_EVENT_IDX(event_num) ((event_num) - NRF_WIFI_UMAC_EVENT_UNSPECIFIED)
+
+#define UMAC_EVENT_DESC(event_num, fn, len)			\
+	[UMAC_EVENT_IDX(event_num)] = {				\
+		.handler = fn,					\
+		.min_len = len,					\
+	}
+
+/* Built-in handlers. Events which are passed on to the OS layer as is only
+ * need the common header, the OS callbacks validate the rest. Events which
+ * are parsed here need the full event structure.
+ */
+static const struct nrf_wifi_umac_event_desc umac_event_descs[NRF_WIFI_UMAC_EVENT_NUM] = {
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_REG,
+			umac_event_get_reg,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_REG_CHANGE,
+			umac_event_reg_change,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TRIGGER_SCAN_START,
+			umac_event_scan_start,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_DONE,
+			umac_event_scan_done,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_ABORTED,
+			umac_event_scan_abort,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_DISPLAY_RESULT,
+			umac_event_disp_scan_res,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_IFFLAGS_STATUS,
+			umac_event_ifflags_status,
+			sizeof(struct nrf_wifi_umac_event_vif_state)),
+#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SET_INTERFACE,
+			umac_event_set_if,
+			sizeof(struct nrf_wifi_umac_hdr)),
+#endif /* NRF70_STA_MODE || NRF70_RAW_DATA_RX */
+#ifdef NRF70_STA_MODE
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TWT_SLEEP,
+			umac_event_twt_sleep,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_RESULT,
+			umac_event_scan_res,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_AUTHENTICATE,
+			umac_event_auth_resp,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_ASSOCIATE,
+			umac_event_assoc_resp,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DEAUTHENTICATE,
+			umac_event_deauth,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DISASSOCIATE,
+			umac_event_disassoc,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_FRAME,
+			umac_event_mgmt_rx,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_TX_POWER,
+			umac_event_tx_pwr_get,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_CHANNEL,
+			umac_event_chnl_get,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_STATION,
+			umac_event_get_station,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_INTERFACE,
+			umac_event_get_interface,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_COOKIE_RESP,
+			umac_event_cookie_rsp,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_FRAME_TX_STATUS,
+			umac_event_mgmt_tx_status,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_UNPROT_DEAUTHENTICATE,
+			umac_event_unprot_mlme_mgmt_rx,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_UNPROT_DISASSOCIATE,
+			umac_event_unprot_mlme_mgmt_rx,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CONFIG_TWT,
+			umac_event_twt_config,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TEARDOWN_TWT,
+			umac_event_twt_teardown,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_WIPHY,
+			umac_event_get_wiphy,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CMD_STATUS,
+			umac_event_cmd_status,
+			sizeof(struct nrf_wifi_umac_event_cmd_status)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_BEACON_HINT,
+			umac_event_nop,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CONNECT,
+			umac_event_nop,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DISCONNECT,
+			umac_event_nop,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO,
+			umac_event_get_ps_info,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_STATION,
+			umac_event_station,
+			sizeof(struct nrf_wifi_umac_event_new_station)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DEL_STATION,
+			umac_event_station,
+			sizeof(struct nrf_wifi_umac_event_new_station)),
+#ifdef NRF70_P2P_MODE
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_REMAIN_ON_CHANNEL,
+			umac_event_roc,
+			sizeof(struct nrf_wifi_umac_hdr)),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CANCEL_REMAIN_ON_CHANNEL,
+			umac_event_roc_cancel,
+			sizeof(struct nrf_wifi_umac_hdr)),
+#endif /* NRF70_P2P_MODE */
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_CONNECTION_INFO,
+			umac_event_get_conn_info,
+			sizeof(struct nrf_wifi_umac_hdr)),
+#endif /* NRF70_STA_MODE */
+};
+
+
 static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						    void *event_data,
 						    unsigned int event_len)
@@ -515,13 +1059,15 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
 	struct nrf_wifi_umac_hdr *umac_hdr = NULL;
 	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
-	struct nrf_wifi_fmac_callbk_fns *callbk_fns = NULL;
-	struct nrf_wifi_umac_event_vif_state *evnt_vif_state = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
-	bool more_res = false;
+	const struct nrf_wifi_umac_event_desc *desc = NULL;
+	struct nrf_wifi_umac_event_stats *stats = NULL;
 	unsigned char if_id = 0;
 	unsigned int event_num = 0;
+	unsigned int event_idx = 0;
+	unsigned long start_time_us = 0;
+	unsigned int proc_time_us = 0;
 
 	if (!fmac_dev_ctx || !event_data) {
 		nrf_wifi_osal_log_err("%s: Invalid parameters",
@@ -554,12 +1100,6 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 				      __func__);
 		goto out;
 	}
-	callbk_fns = &sys_fpriv->callbk_fns;
-	if (!callbk_fns) {
-		nrf_wifi_osal_log_err("%s: Invalid callbk_fns",
-				      __func__);
-		goto out;
-	}
 
 #ifdef NRF_WIFI_CMD_EVENT_LOG
 	nrf_wifi_osal_log_info("%s: Event %d received from UMAC",
@@ -571,340 +1111,56 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 			      event_num);
 #endif /* NRF_WIFI_CMD_EVENT_LOG */
 
-	switch (umac_hdr->cmd_evnt) {
-	case NRF_WIFI_UMAC_EVENT_GET_REG:
-		if (callbk_fns->event_get_reg)
-			callbk_fns->event_get_reg(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_REG_CHANGE:
-		if (callbk_fns->reg_change_callbk_fn)
-			callbk_fns->reg_change_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_TRIGGER_SCAN_START:
-		if (callbk_fns->scan_start_callbk_fn)
-			callbk_fns->scan_start_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_DONE:
-		if (callbk_fns->scan_done_callbk_fn)
-			callbk_fns->scan_done_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_ABORTED:
-		if (callbk_fns->scan_abort_callbk_fn)
-			callbk_fns->scan_abort_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_DISPLAY_RESULT:
-		if (umac_hdr->seq != 0)
-			more_res = true;
-
-		if (callbk_fns->disp_scan_res_callbk_fn)
-			callbk_fns->disp_scan_res_callbk_fn(vif_ctx->os_vif_ctx,
-							    event_data,
-							    event_len,
-							    more_res);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_IFFLAGS_STATUS:
-		evnt_vif_state = (struct nrf_wifi_umac_event_vif_state *)event_data;
+	event_idx = UMAC_EVENT_IDX(event_num);
 
-		if (evnt_vif_state->status < 0) {
-			nrf_wifi_osal_log_err("%s: Failed to set interface flags: %d",
-					      __func__,
-						evnt_vif_state->status);
-			goto out;
-		}
-		vif_ctx->ifflags = true;
-		break;
-#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
-	case NRF_WIFI_UMAC_EVENT_SET_INTERFACE:
-		if (callbk_fns->set_if_callbk_fn)
-			callbk_fns->set_if_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif
-#ifdef NRF70_STA_MODE
-	case NRF_WIFI_UMAC_EVENT_TWT_SLEEP:
-		if (callbk_fns->twt_sleep_callbk_fn)
-			callbk_fns->twt_sleep_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_RESULT:
-		if (umac_hdr->seq != 0)
-			more_res = true;
-
-		if (callbk_fns->scan_res_callbk_fn)
-			callbk_fns->scan_res_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len,
-						       more_res);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_AUTHENTICATE:
-		if (callbk_fns->auth_resp_callbk_fn)
-			callbk_fns->auth_resp_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_ASSOCIATE:
-		if (callbk_fns->assoc_resp_callbk_fn)
-			callbk_fns->assoc_resp_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_DEAUTHENTICATE:
-		if (callbk_fns->deauth_callbk_fn)
-			callbk_fns->deauth_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_DISASSOCIATE:
-		if (callbk_fns->disassoc_callbk_fn)
-			callbk_fns->disassoc_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_FRAME:
-		if (callbk_fns->mgmt_rx_callbk_fn)
-			callbk_fns->mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_TX_POWER:
-		if (callbk_fns->tx_pwr_get_callbk_fn)
-			callbk_fns->tx_pwr_get_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_CHANNEL:
-		if (callbk_fns->chnl_get_callbk_fn)
-			callbk_fns->chnl_get_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_STATION:
-		if (callbk_fns->get_station_callbk_fn)
-			callbk_fns->get_station_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_NEW_INTERFACE:
-		if (callbk_fns->get_interface_callbk_fn)
-			callbk_fns->get_interface_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_COOKIE_RESP:
-		if (callbk_fns->cookie_rsp_callbk_fn)
-			callbk_fns->cookie_rsp_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_FRAME_TX_STATUS:
-		if (callbk_fns->mgmt_tx_status)
-			callbk_fns->mgmt_tx_status(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_UNPROT_DEAUTHENTICATE:
-	case NRF_WIFI_UMAC_EVENT_UNPROT_DISASSOCIATE:
-		if (callbk_fns->unprot_mlme_mgmt_rx_callbk_fn)
-			callbk_fns->unprot_mlme_mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
-								  event_data,
-								  event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CONFIG_TWT:
-		if (callbk_fns->twt_config_callbk_fn)
-			callbk_fns->twt_config_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_TEARDOWN_TWT:
-		if (callbk_fns->twt_teardown_callbk_fn)
-			callbk_fns->twt_teardown_callbk_fn(vif_ctx->os_vif_ctx,
-							   event_data,
-							   event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_NEW_WIPHY:
-		if (callbk_fns->event_get_wiphy)
-			callbk_fns->event_get_wiphy(vif_ctx->os_vif_ctx,
-						    event_data,
-						    event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CMD_STATUS:
-#if WIFI_NRF70_LOG_LEVEL >= NRF_WIFI_LOG_LEVEL_DBG
-		struct nrf_wifi_umac_event_cmd_status *cmd_status =
-			(struct nrf_wifi_umac_event_cmd_status *)event_data;
-#endif
-		nrf_wifi_osal_log_dbg("%s: Command %d -> status %d",
+	if (event_idx >= NRF_WIFI_UMAC_EVENT_NUM) {
+		nrf_wifi_osal_log_dbg("%s: No callback registered for event %d",
 				      __func__,
-				      cmd_status->cmd_id,
-				      cmd_status->cmd_status);
-		break;
-	case NRF_WIFI_UMAC_EVENT_BEACON_HINT:
-	case NRF_WIFI_UMAC_EVENT_CONNECT:
-	case NRF_WIFI_UMAC_EVENT_DISCONNECT:
-		/* Nothing to be done */
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO:
-		if (callbk_fns->event_get_ps_info)
-			callbk_fns->event_get_ps_info(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#ifdef NRF70_STA_MODE
-	case NRF_WIFI_UMAC_EVENT_NEW_STATION:
-	case NRF_WIFI_UMAC_EVENT_DEL_STATION:
-		umac_event_connect(fmac_dev_ctx,
-				   event_data);
-		break;
-#endif /* NRF70_STA_MODE */
-#ifdef NRF70_P2P_MODE
-	case NRF_WIFI_UMAC_EVENT_REMAIN_ON_CHANNEL:
-		if (callbk_fns->roc_callbk_fn)
-			callbk_fns->roc_callbk_fn(vif_ctx->os_vif_ctx,
-						  event_data,
-						  event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CANCEL_REMAIN_ON_CHANNEL:
-		if (callbk_fns->roc_cancel_callbk_fn)
-			callbk_fns->roc_cancel_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif /* NRF70_P2P_MODE */
-	case NRF_WIFI_UMAC_EVENT_GET_CONNECTION_INFO:
-		if (callbk_fns->get_conn_info_callbk_fn)
-			callbk_fns->get_conn_info_callbk_fn(vif_ctx->os_vif_ctx,
-							    event_data,
-							    event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif /* NRF70_STA_MODE */
-	default:
+				      event_num);
+		goto out;
+	}
+
+	stats = &sys_dev_ctx->umac_event_stats[event_idx];
+	stats->count++;
+
+	desc = &sys_dev_ctx->umac_event_handlers[event_idx];
+
+	if (!desc->handler) {
+		desc = &umac_event_descs[event_idx];
+	}
+
+	if (!desc->handler) {
 		nrf_wifi_osal_log_dbg("%s: No callback registered for event %d",
 				      __func__,
-				      umac_hdr->cmd_evnt);
-		break;
+				      event_num);
+		goto out;
+	}
+
+	if (event_len < desc->min_len) {
+		nrf_wifi_osal_log_err("%s: Event %d too short (%d < %d)",
+				      __func__,
+				      event_num,
+				      event_len,
+				      desc->min_len);
+		stats->len_errs++;
+		goto out;
+	}
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+	if (desc->handler(fmac_dev_ctx,
+			  vif_ctx,
+			  event_data,
+			  event_len) != NRF_WIFI_STATUS_SUCCESS) {
+		stats->handler_errs++;
+	}
+
+	proc_time_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+	stats->total_time_us += proc_time_us;
+
+	if (proc_time_us > stats->max_time_us) {
+		stats->max_time_us = proc_time_us;
 	}
 
 	nrf_wifi_osal_log_dbg("%s: Event %d processed",
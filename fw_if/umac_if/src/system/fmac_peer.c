@@ -46,6 +46,23 @@ int nrf_wifi_fmac_peer_get_id(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	return -1;
 }
 
+#ifdef NRF70_TX_FLOW_CACHE
+/* Invalidate the cached TX classification results, to be called whenever
+ * the peers, the VIFs or the QoS mapping change.
+ */
+void nrf_wifi_fmac_tx_flow_cache_flush(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	/* Generation 0 is never current, so that cleared entries are stale */
+	if (++sys_dev_ctx->tx_config.flow_cache.gen == 0) {
+		sys_dev_ctx->tx_config.flow_cache.gen = 1;
+	}
+}
+#endif /* NRF70_TX_FLOW_CACHE */
+
 int nrf_wifi_fmac_peer_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			   unsigned char if_idx,
 			   const unsigned char *mac_addr,
@@ -67,7 +84,10 @@ int nrf_wifi_fmac_peer_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		sys_dev_ctx->tx_config.peers[MAX_PEERS].if_idx = if_idx;
 		sys_dev_ctx->tx_config.peers[MAX_PEERS].peer_id = MAX_PEERS;
 		sys_dev_ctx->tx_config.peers[MAX_PEERS].is_legacy = 1;
+#ifdef NRF70_TX_FLOW_CACHE
 
+		nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 
 		return MAX_PEERS;
 	}
@@ -83,6 +103,9 @@ int nrf_wifi_fmac_peer_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			peer->peer_id = i;
 			peer->is_legacy = is_legacy;
 			peer->qos_supported = qos_supported;
+#ifdef NRF70_TX_FLOW_CACHE
+			nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 #ifndef NRF71_ON_IPC
 			if (vif_ctx->if_type == NRF_WIFI_IFTYPE_AP) {
 				hal_rpu_mem_write(fmac_dev_ctx->hal_dev_ctx,
@@ -137,6 +160,10 @@ void nrf_wifi_fmac_peer_remove(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			      0x0,
 			      sizeof(struct peers_info));
 	peer->peer_id = -1;
+#ifdef NRF70_TX_FLOW_CACHE
+
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 }
 
 
@@ -177,4 +204,8 @@ void nrf_wifi_fmac_peers_flush(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		}
 	}
 #endif /* !NRF71_ON_IPC */
+#ifdef NRF70_TX_FLOW_CACHE
+
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+#endif /* NRF70_TX_FLOW_CACHE */
 }
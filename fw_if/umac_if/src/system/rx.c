@@ -9,6 +9,8 @@
  * FMAC IF Layer of the Wi-Fi driver.
  */
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_RX
+
 #include "system/hal_api.h"
 #include "system/fmac_rx.h"
 #include "common/fmac_util.h"
@@ -22,28 +24,83 @@ static enum nrf_wifi_status
 nrf_wifi_fmac_map_desc_to_pool(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				   unsigned int desc_id,
 				   struct nrf_wifi_fmac_rx_pool_map_info *pool_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	if (!sys_dev_ctx->rx_desc_map ||
+	    (desc_id >= sys_fpriv->num_rx_bufs)) {
+		goto out;
+	}
+
+	*pool_info = sys_dev_ctx->rx_desc_map[desc_id];
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_rx_desc_map_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 	unsigned int pool_id = 0;
+	unsigned int buf_id = 0;
+	unsigned int desc_id = 0;
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
 
+	sys_dev_ctx->rx_desc_map = nrf_wifi_osal_mem_zalloc(sys_fpriv->num_rx_bufs *
+							    sizeof(*sys_dev_ctx->rx_desc_map));
+
+	if (!sys_dev_ctx->rx_desc_map) {
+		nrf_wifi_osal_log_err("%s: No space for RX descriptor map",
+				      __func__);
+		goto out;
+	}
+
 	for (pool_id = 0; pool_id < MAX_NUM_OF_RX_QUEUES; pool_id++) {
-		if ((desc_id >= sys_fpriv->rx_desc[pool_id]) &&
-			(desc_id < (sys_fpriv->rx_desc[pool_id] +
-				sys_fpriv->rx_buf_pools[pool_id].num_bufs))) {
-			pool_info->pool_id = pool_id;
-			pool_info->buf_id = (desc_id - sys_fpriv->rx_desc[pool_id]);
-			status = NRF_WIFI_STATUS_SUCCESS;
-			goto out;
+		for (buf_id = 0; buf_id < sys_fpriv->rx_buf_pools[pool_id].num_bufs; buf_id++) {
+			desc_id = sys_fpriv->rx_desc[pool_id] + buf_id;
+
+			if (desc_id >= sys_fpriv->num_rx_bufs) {
+				nrf_wifi_osal_log_err("%s: Invalid desc_id %d for pool %d",
+						      __func__,
+						      desc_id,
+						      pool_id);
+				nrf_wifi_fmac_rx_desc_map_deinit(fmac_dev_ctx);
+				goto out;
+			}
+
+			sys_dev_ctx->rx_desc_map[desc_id].pool_id = pool_id;
+			sys_dev_ctx->rx_desc_map[desc_id].buf_id = buf_id;
 		}
 	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
 out:
 	return status;
 }
+
+
+void nrf_wifi_fmac_rx_desc_map_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (sys_dev_ctx->rx_desc_map) {
+		nrf_wifi_osal_mem_free(sys_dev_ctx->rx_desc_map);
+		sys_dev_ctx->rx_desc_map = NULL;
+	}
+}
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 unsigned long nrf_wifi_fmac_get_rx_buf_map_addr(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						   unsigned int desc_id)
@@ -204,6 +261,242 @@ static void nrf_wifi_convert_to_eth(void *nwb,
 }
 #endif /* NRF70_STA_MODE */
 
+#ifdef NRF70_RX_BUF_RECYCLE
+enum nrf_wifi_status nrf_wifi_fmac_rx_buf_free_list_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_rx_buf_free_list *free_list = NULL;
+	unsigned int pool_id = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	sys_dev_ctx->rx_buf_free_list_lock = nrf_wifi_osal_spinlock_alloc();
+
+	if (!sys_dev_ctx->rx_buf_free_list_lock) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate lock",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_init(sys_dev_ctx->rx_buf_free_list_lock);
+
+	for (pool_id = 0; pool_id < MAX_NUM_OF_RX_QUEUES; pool_id++) {
+		free_list = &sys_dev_ctx->rx_buf_free_list[pool_id];
+
+		free_list->max_bufs = sys_fpriv->rx_buf_pools[pool_id].num_bufs;
+		free_list->num_bufs = 0;
+
+		if (!free_list->max_bufs) {
+			continue;
+		}
+
+		free_list->bufs = nrf_wifi_osal_mem_zalloc(free_list->max_bufs *
+							   sizeof(*free_list->bufs));
+
+		if (!free_list->bufs) {
+			nrf_wifi_osal_log_err("%s: No space for RX buffer free list %d",
+					      __func__,
+					      pool_id);
+			nrf_wifi_fmac_rx_buf_free_list_deinit(fmac_dev_ctx);
+			goto out;
+		}
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+void nrf_wifi_fmac_rx_buf_free_list_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_rx_buf_free_list *free_list = NULL;
+	unsigned int pool_id = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (pool_id = 0; pool_id < MAX_NUM_OF_RX_QUEUES; pool_id++) {
+		free_list = &sys_dev_ctx->rx_buf_free_list[pool_id];
+
+		while (free_list->num_bufs) {
+			nrf_wifi_osal_nbuf_free(free_list->bufs[--free_list->num_bufs]);
+		}
+
+		if (free_list->bufs) {
+			nrf_wifi_osal_mem_free(free_list->bufs);
+			free_list->bufs = NULL;
+		}
+
+		free_list->max_bufs = 0;
+	}
+
+	if (sys_dev_ctx->rx_buf_free_list_lock) {
+		nrf_wifi_osal_spinlock_free(sys_dev_ctx->rx_buf_free_list_lock);
+		sys_dev_ctx->rx_buf_free_list_lock = NULL;
+	}
+}
+
+
+void nrf_wifi_fmac_rx_buf_put(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      unsigned int pool_id,
+			      void *nwb)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_rx_buf_free_list *free_list = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	free_list = &sys_dev_ctx->rx_buf_free_list[pool_id];
+
+	nrf_wifi_osal_nbuf_reset(nwb);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->rx_buf_free_list_lock);
+
+	if (free_list->num_bufs < free_list->max_bufs) {
+		free_list->bufs[free_list->num_bufs++] = nwb;
+		nwb = NULL;
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->rx_buf_free_list_lock);
+
+	if (nwb) {
+		nrf_wifi_osal_nbuf_free(nwb);
+	}
+}
+
+
+static void *rx_buf_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			unsigned int pool_id)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_rx_buf_free_list *free_list = NULL;
+	void *nwb = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	free_list = &sys_dev_ctx->rx_buf_free_list[pool_id];
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->rx_buf_free_list_lock);
+
+	if (free_list->num_bufs) {
+		nwb = free_list->bufs[--free_list->num_bufs];
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->rx_buf_free_list_lock);
+
+	return nwb;
+}
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+void nrf_wifi_fmac_rx_refill_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_rx_refill *refill = NULL;
+	unsigned int pool_id = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (pool_id = 0; pool_id < MAX_NUM_OF_RX_QUEUES; pool_id++) {
+		refill = &sys_dev_ctx->rx_refill[pool_id];
+
+		nrf_wifi_osal_nbuf_free_bulk(refill->bufs,
+					     refill->num_bufs);
+		refill->num_bufs = 0;
+	}
+}
+
+
+static void *rx_buf_refill_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       unsigned int pool_id,
+			       unsigned int buf_len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_rx_refill *refill = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	refill = &sys_dev_ctx->rx_refill[pool_id];
+
+	if (!refill->num_bufs) {
+		refill->num_bufs = nrf_wifi_osal_nbuf_alloc_bulk(buf_len,
+								 refill->bufs,
+								 NRF_WIFI_FMAC_RX_REFILL_BULK);
+#ifdef NRF70_RAW_RX_BATCH
+
+		/* Room for the metadata of a raw frame, see raw_rx_batch_add() */
+		nrf_wifi_osal_nbuf_headroom_res_bulk(refill->bufs,
+						     refill->num_bufs,
+						     RX_BUF_META_LEN);
+#endif /* NRF70_RAW_RX_BATCH */
+	}
+
+	if (!refill->num_bufs) {
+		return NULL;
+	}
+
+	return refill->bufs[--refill->num_bufs];
+}
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+
+/* Get a RX buffer of a pool, ready to be handed over to the RPU. */
+static void *rx_buf_alloc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			  unsigned int pool_id,
+			  unsigned int buf_len)
+{
+	void *nwb = NULL;
+
+#ifdef NRF70_RX_BUF_RECYCLE
+	nwb = rx_buf_get(fmac_dev_ctx,
+			 pool_id);
+
+	if (nwb) {
+#ifdef NRF70_RAW_RX_BATCH
+		nrf_wifi_osal_nbuf_headroom_res(nwb,
+						RX_BUF_META_LEN);
+#endif /* NRF70_RAW_RX_BATCH */
+		return nwb;
+	}
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	nwb = rx_buf_refill_get(fmac_dev_ctx,
+				pool_id,
+				buf_len);
+#else
+	nwb = nrf_wifi_osal_nbuf_alloc(buf_len);
+#ifdef NRF70_RAW_RX_BATCH
+
+	/* Room for the metadata of a raw frame, see raw_rx_batch_add() */
+	if (nwb) {
+		nrf_wifi_osal_nbuf_headroom_res(nwb,
+						RX_BUF_META_LEN);
+	}
+#endif /* NRF70_RAW_RX_BATCH */
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+	return nwb;
+}
+
+
+/* Release a RX buffer which is not handed over to the upper layer. */
+static void rx_buf_drop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			unsigned int pool_id,
+			void *nwb)
+{
+#ifdef NRF70_RX_BUF_RECYCLE
+	nrf_wifi_fmac_rx_buf_put(fmac_dev_ctx,
+				 pool_id,
+				 nwb);
+#else
+	nrf_wifi_osal_nbuf_free(nwb);
+#endif /* NRF70_RX_BUF_RECYCLE */
+}
+
+
 enum nrf_wifi_status nrf_wifi_fmac_rx_cmd_send(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						   enum nrf_wifi_fmac_rx_cmd_type cmd_type,
 						   unsigned int desc_id)
@@ -247,7 +540,9 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_cmd_send(struct nrf_wifi_fmac_dev_ctx *fma
 			goto out;
 		}
 
-		nwb = (unsigned long)nrf_wifi_osal_nbuf_alloc(buf_len);
+		nwb = (unsigned long)rx_buf_alloc(fmac_dev_ctx,
+						  pool_info.pool_id,
+						  buf_len + RX_BUF_META_LEN);
 
 		if (!nwb) {
 			nrf_wifi_osal_log_err("%s: No space for allocating RX buffer",
@@ -386,6 +681,93 @@ out:
 }
 #endif /* NRF70_RX_WQ_ENABLED */
 
+#ifdef NRF70_RAW_RX_BATCH
+#if defined(NRF70_PROMISC_DATA_RX) && !defined(NRF71_ON_IPC)
+/* Apply the packet filter to a raw frame still held by the RPU, only its
+ * frame control field is read so that filtered frames are never copied.
+ */
+static bool raw_rx_filtered(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			    struct nrf_wifi_fmac_rx_pool_map_info *pool_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned short frame_control = 0;
+
+	status = nrf_wifi_sys_hal_buf_peek_rx(fmac_dev_ctx->hal_dev_ctx,
+					      &frame_control,
+					      sizeof(frame_control),
+					      pool_info->pool_id,
+					      pool_info->buf_id);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		return false;
+	}
+
+	return !nrf_wifi_util_check_filt_setting(vif_ctx,
+						 &frame_control);
+}
+#endif /* NRF70_PROMISC_DATA_RX && !NRF71_ON_IPC */
+
+
+static void raw_rx_batch_flush(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       struct nrf_wifi_fmac_vif_ctx *vif_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_raw_rx_batch *batch = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	batch = &sys_dev_ctx->raw_rx_batch;
+
+	if (!batch->num_frms) {
+		return;
+	}
+
+	sys_fpriv->callbk_fns.sniffer_batch_callbk_fn(vif_ctx->os_vif_ctx,
+						      batch->frms,
+						      batch->num_frms);
+
+	batch->stats.num_batches++;
+	batch->stats.num_frms += batch->num_frms;
+
+	if (batch->num_frms > batch->stats.max_batch_len) {
+		batch->stats.max_batch_len = batch->num_frms;
+	}
+
+	batch->num_frms = 0;
+}
+
+
+static void raw_rx_batch_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			     struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			     void *nwb,
+			     struct raw_rx_pkt_header *raw_rx_hdr)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_raw_rx_batch *batch = NULL;
+	void *meta = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	batch = &sys_dev_ctx->raw_rx_batch;
+
+	/* The metadata goes in the headroom reserved at allocation */
+	meta = nrf_wifi_osal_nbuf_data_push(nwb,
+					    sizeof(*raw_rx_hdr));
+
+	nrf_wifi_osal_mem_cpy(meta,
+			      raw_rx_hdr,
+			      sizeof(*raw_rx_hdr));
+
+	batch->frms[batch->num_frms++] = nwb;
+
+	if (batch->num_frms == NRF70_RAW_RX_BATCH_MAX) {
+		raw_rx_batch_flush(fmac_dev_ctx,
+				   vif_ctx);
+	}
+}
+#endif /* NRF70_RAW_RX_BATCH */
+
 enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 							struct nrf_wifi_rx_buff *config)
 {
@@ -398,6 +780,9 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 #if defined(NRF70_PROMISC_DATA_RX)
 	unsigned short frame_control;
 #endif
+#ifdef NRF70_RAW_RX_BATCH
+	bool raw_rx_drop = false;
+#endif /* NRF70_RAW_RX_BATCH */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 	void *nwb = NULL;
 	void *nwb_data = NULL;
@@ -456,6 +841,20 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 			status = NRF_WIFI_STATUS_FAIL;
 			continue;
 		}
+#ifdef NRF70_RAW_RX_BATCH
+		raw_rx_drop = false;
+#if defined(NRF70_PROMISC_DATA_RX) && !defined(NRF71_ON_IPC)
+
+		if ((config->rx_pkt_type == NRF_WIFI_RAW_RX_PKT) &&
+		    raw_rx_filtered(fmac_dev_ctx,
+				    vif_ctx,
+				    &pool_info)) {
+			/* Unmap without reading the frame from the RPU */
+			raw_rx_drop = true;
+			pkt_len = 0;
+		}
+#endif /* NRF70_PROMISC_DATA_RX && !NRF71_ON_IPC */
+#endif /* NRF70_RAW_RX_BATCH */
 #ifndef NRF71_ON_IPC
 		nwb_data = (void *)nrf_wifi_sys_hal_buf_unmap_rx(fmac_dev_ctx->hal_dev_ctx,
 								 pkt_len,
@@ -494,6 +893,12 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 					  nwb_data,
 					  sizeof(unsigned short));
 #endif
+#if defined(NRF70_RAW_RX_BATCH) && defined(NRF70_PROMISC_DATA_RX) && defined(NRF71_ON_IPC)
+		if (config->rx_pkt_type == NRF_WIFI_RAW_RX_PKT) {
+			raw_rx_drop = !nrf_wifi_util_check_filt_setting(vif_ctx,
+									&frame_control);
+		}
+#endif /* NRF70_RAW_RX_BATCH && NRF70_PROMISC_DATA_RX && NRF71_ON_IPC */
 
 		if (config->rx_pkt_type == NRF_WIFI_RX_PKT_DATA) {
 #ifdef NRF70_PROMISC_DATA_RX
@@ -558,7 +963,9 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 							config->frequency,
 							config->signal);
 #endif /* WIFI_MGMT_RAW_SCAN_RESULTS */
-			nrf_wifi_osal_nbuf_free(nwb);
+			rx_buf_drop(fmac_dev_ctx,
+				    pool_info.pool_id,
+				    nwb);
 #ifdef NRF_WIFI_MGMT_BUFF_OFFLOAD
 			continue;
 #endif /* NRF_WIFI_MGMT_BUFF_OFFLOAD */
@@ -569,6 +976,19 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 			raw_rx_hdr.signal = config->signal;
 			raw_rx_hdr.rate_flags = config->rate_flags;
 			raw_rx_hdr.rate = config->rate;
+#ifdef NRF70_RAW_RX_BATCH
+			if (raw_rx_drop) {
+				sys_dev_ctx->raw_rx_batch.stats.num_filtered++;
+				rx_buf_drop(fmac_dev_ctx,
+					    pool_info.pool_id,
+					    nwb);
+			} else if (sys_fpriv->callbk_fns.sniffer_batch_callbk_fn) {
+				raw_rx_batch_add(fmac_dev_ctx,
+						 vif_ctx,
+						 nwb,
+						 &raw_rx_hdr);
+			} else
+#endif /* NRF70_RAW_RX_BATCH */
 #if defined(NRF70_PROMISC_DATA_RX)
 			if (nrf_wifi_util_check_filt_setting(vif_ctx, &frame_control))
 #endif
@@ -586,7 +1006,9 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 			 * to be freed here.
 			 */
 			else {
-				nrf_wifi_osal_nbuf_free(nwb);
+				rx_buf_drop(fmac_dev_ctx,
+					    pool_info.pool_id,
+					    nwb);
 			}
 #endif
 		}
@@ -596,7 +1018,9 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 						  __func__,
 						  config->rx_pkt_type);
 			status = NRF_WIFI_STATUS_FAIL;
-			nrf_wifi_osal_nbuf_free(nwb);
+			rx_buf_drop(fmac_dev_ctx,
+				    pool_info.pool_id,
+				    nwb);
 			continue;
 		}
 
@@ -624,6 +1048,10 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 		}
 #endif /*NRF_WIFI_RX_BUFF_PROG_UMAC */
 	}
+#ifdef NRF70_RAW_RX_BATCH
+	raw_rx_batch_flush(fmac_dev_ctx,
+			   vif_ctx);
+#endif /* NRF70_RAW_RX_BATCH */
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 	status = nrf_wifi_fmac_prog_rx_buf_info(fmac_dev_ctx,
 												rx_buf_ipc,
@@ -9,6 +9,8 @@
  * FMAC IF Layer of the Wi-Fi driver.
  */
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_TX
+
 #include "list.h"
 #include "queue.h"
 #include "system/hal_api.h"
@@ -260,6 +262,187 @@ int pending_frames_count(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF70_TX_AQM)
+/* The pending queues are FIFOs bounded by NRF70_MAX_TX_PENDING_QLEN, except
+ * for TWT emergency frames which go to the head. The enqueue timestamps are
+ * kept in a ring per queue which mirrors the queue contents, so the ring
+ * length is always the queue length.
+ */
+static void tx_pend_q_tstamp_push(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  unsigned int peer_id,
+				  unsigned int ac,
+				  bool head)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned char *ring_head = NULL;
+	unsigned int qlen = 0;
+	unsigned int idx = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	ring_head = &sys_dev_ctx->tx_config.pend_q_tstamp_head[peer_id][ac];
+	qlen = nrf_wifi_utils_q_len(sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac]);
+
+	if (head) {
+		*ring_head = (*ring_head + NRF70_MAX_TX_PENDING_QLEN - 1) %
+			NRF70_MAX_TX_PENDING_QLEN;
+		idx = *ring_head;
+	} else {
+		idx = (*ring_head + qlen) % NRF70_MAX_TX_PENDING_QLEN;
+	}
+
+	sys_dev_ctx->tx_config.pend_q_tstamp[peer_id][ac][idx] =
+		nrf_wifi_osal_time_get_curr_us();
+}
+
+
+static unsigned long tx_pend_q_tstamp_peek(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   unsigned int peer_id,
+					   unsigned int ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned char ring_head = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	ring_head = sys_dev_ctx->tx_config.pend_q_tstamp_head[peer_id][ac];
+
+	return sys_dev_ctx->tx_config.pend_q_tstamp[peer_id][ac][ring_head];
+}
+
+
+static unsigned long tx_pend_q_tstamp_pop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					  unsigned int peer_id,
+					  unsigned int ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned char *ring_head = NULL;
+	unsigned long tstamp = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	ring_head = &sys_dev_ctx->tx_config.pend_q_tstamp_head[peer_id][ac];
+	tstamp = sys_dev_ctx->tx_config.pend_q_tstamp[peer_id][ac][*ring_head];
+
+	*ring_head = (*ring_head + 1) % NRF70_MAX_TX_PENDING_QLEN;
+
+	return tstamp;
+}
+#endif /* NRF70_TX_LATENCY_STATS || NRF70_TX_AQM */
+
+
+#ifdef NRF70_TX_LATENCY_STATS
+static void tx_lat_hist_add(struct nrf_wifi_tx_lat_hist *hist,
+			    unsigned int val)
+{
+	static const unsigned int bin_bounds[NRF_WIFI_TX_LAT_HIST_BINS - 1] = {
+		500, 1000, 2000, 5000, 10000, 20000, 50000
+	};
+	unsigned int bin = 0;
+
+	while ((bin < (NRF_WIFI_TX_LAT_HIST_BINS - 1)) &&
+	       (val >= bin_bounds[bin])) {
+		bin++;
+	}
+
+	hist->bins[bin]++;
+	hist->count++;
+	hist->sum += val;
+
+	if (val > hist->max) {
+		hist->max = val;
+	}
+}
+
+
+static void tx_lat_post(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			unsigned int desc,
+			unsigned int num_frames)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	unsigned long now = 0;
+	unsigned int desc_id = 0;
+	unsigned int frame = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+	now = nrf_wifi_osal_time_get_curr_us();
+
+	for (frame = 0; frame < num_frames; frame++) {
+		desc_id = (desc * sys_fpriv->data_config.max_tx_aggregation) + frame;
+
+		tx_lat_hist_add(&sys_dev_ctx->tx_config.lat_stats.enq_to_post[pkt_info->ac],
+				now - sys_dev_ctx->tx_config.desc_enq_tstamp_p[desc_id]);
+	}
+
+	/* 0 is used as the "not posted" marker */
+	pkt_info->post_tstamp_us = now ? now : 1;
+}
+
+
+static unsigned long long tx_lat_phy_tstamp(const unsigned char *tstamp)
+{
+	unsigned long long val = 0;
+	int i = 0;
+
+	/* 48-bit little endian PHY timer value */
+	for (i = 5; i >= 0; i--) {
+		val = (val << 8) | tstamp[i];
+	}
+
+	return val;
+}
+
+
+static void tx_lat_done(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			unsigned int desc,
+			const unsigned char *timestamp_t1,
+			const unsigned char *timestamp_t4)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	unsigned long long t1 = 0;
+	unsigned long long t4 = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	if (desc >= sys_fpriv->num_tx_tokens) {
+		return;
+	}
+
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+	if (!pkt_info->post_tstamp_us) {
+		return;
+	}
+
+	tx_lat_hist_add(&sys_dev_ctx->tx_config.lat_stats.post_to_done[pkt_info->ac],
+			nrf_wifi_osal_time_elapsed_us(pkt_info->post_tstamp_us));
+
+	pkt_info->post_tstamp_us = 0;
+
+	if (!timestamp_t1 || !timestamp_t4) {
+		return;
+	}
+
+	t1 = tx_lat_phy_tstamp(timestamp_t1);
+	t4 = tx_lat_phy_tstamp(timestamp_t4);
+
+	/* The firmware leaves the timestamps at zero when they are not captured */
+	if (t1 && (t4 >= t1)) {
+		tx_lat_hist_add(&sys_dev_ctx->tx_config.lat_stats.phy_t1_t4[pkt_info->ac],
+				(unsigned int)(t4 - t1));
+	}
+}
+#endif /* NRF70_TX_LATENCY_STATS */
+
+
 static enum nrf_wifi_status update_pend_q_bmp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				       unsigned int ac,
 				       int peer_id)
@@ -425,6 +608,109 @@ unsigned int tx_desc_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#ifdef NRF70_RAW_TX_BATCH
+#ifndef NRF70_RAW_DATA_TX
+#error "NRF70_RAW_TX_BATCH needs NRF70_RAW_DATA_TX for the raw TX header it tags"
+#endif /* NRF70_RAW_DATA_TX */
+
+/* The batch a raw frame belongs to is kept in the reserved bytes of its raw
+ * TX header, as slot index + 1 (0 for frames sent on their own).
+ */
+#define RAW_TX_BATCH_TAG(raw_tx_hdr) ((raw_tx_hdr)->reserved[0])
+
+static unsigned char raw_tx_batch_tag_get(void *nwb)
+{
+	struct raw_tx_pkt_header *raw_tx_hdr = NULL;
+
+	if (!nrf_wifi_osal_nbuf_is_raw_tx(nwb)) {
+		return 0;
+	}
+
+	raw_tx_hdr = nrf_wifi_osal_nbuf_get_raw_tx_hdr(nwb);
+
+	if (!raw_tx_hdr) {
+		return 0;
+	}
+
+	return RAW_TX_BATCH_TAG(raw_tx_hdr);
+}
+
+
+/* Called with the TX lock held */
+static void raw_tx_batch_frms_done(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				   unsigned char tag,
+				   unsigned int num_frms,
+				   bool failed)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_raw_tx_batch *batch = NULL;
+
+	if (!tag || (tag > NRF70_RAW_TX_BATCH_SLOTS)) {
+		return;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	batch = &sys_dev_ctx->raw_tx_batch[tag - 1];
+
+	if (!batch->in_use) {
+		return;
+	}
+
+	batch->num_done += num_frms;
+
+	if (failed) {
+		batch->num_failed += num_frms;
+	}
+}
+
+
+/* Report the completed batches, outside of the TX lock so that the upper
+ * layer can submit the next batch from the callback.
+ */
+static void raw_tx_batch_report(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_raw_tx_batch *batch = NULL;
+	struct nrf_wifi_fmac_raw_tx_batch done;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	bool completed = false;
+	unsigned int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	for (i = 0; i < NRF70_RAW_TX_BATCH_SLOTS; i++) {
+		batch = &sys_dev_ctx->raw_tx_batch[i];
+
+		nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+		completed = batch->in_use && (batch->num_done >= batch->num_frms);
+
+		if (completed) {
+			done = *batch;
+			batch->in_use = false;
+		}
+
+		nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+		if (!completed) {
+			continue;
+		}
+
+		vif_ctx = sys_dev_ctx->vif_ctx[done.if_idx];
+
+		if (vif_ctx && sys_fpriv->callbk_fns.raw_tx_batch_done_callbk_fn) {
+			sys_fpriv->callbk_fns.raw_tx_batch_done_callbk_fn(vif_ctx->os_vif_ctx,
+									  done.cookie,
+									  done.num_frms,
+									  done.num_failed);
+		}
+	}
+}
+#endif /* NRF70_RAW_TX_BATCH */
+
+
 static int tx_aggr_check(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		  void *first_nwb,
 		  int ac,
@@ -443,7 +729,18 @@ static int tx_aggr_check(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 #ifdef NRF70_RAW_DATA_TX
 	if (nrf_wifi_osal_nbuf_is_raw_tx(first_nwb)) {
+#if defined(NRF70_RAW_TX_BATCH) && defined(NRF71_ON_IPC)
+		/* Frames of a batch share their raw TX header and can go in
+		 * the same command.
+		 */
+		pending_pkt_queue = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][ac];
+		nwb = nrf_wifi_utils_q_peek(pending_pkt_queue);
+
+		return nwb && raw_tx_batch_tag_get(first_nwb) &&
+			(raw_tx_batch_tag_get(nwb) == raw_tx_batch_tag_get(first_nwb));
+#else
 		return false;
+#endif /* NRF70_RAW_TX_BATCH && NRF71_ON_IPC */
 	}
 #endif /* NRF70_RAW_DATA_TX */
 
@@ -563,107 +860,372 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	return peer_id;
 }
 
-static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-			unsigned int desc,
-			unsigned int ac)
+/* Dequeue the head of a pending queue into position @frame of TX
+ * descriptor @desc, keeping the per-frame enqueue timestamps in sync.
+ */
+static void *tx_pend_q_dequeue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       void *pend_pkt_q,
+			       unsigned int peer_id,
+			       unsigned int ac,
+			       unsigned int desc,
+			       unsigned int frame)
 {
-	int len = 0;
-	void *pend_pkt_q = NULL;
-	void *txq = NULL;
-	struct tx_pkt_info *pkt_info = NULL;
-	int peer_id = -1;
-	void *nwb = NULL;
-	void *first_nwb = NULL;
-
-	int max_txq_len, avail_ampdu_len_per_token;
-	int ampdu_len = 0;
+#ifdef NRF70_TX_LATENCY_STATS
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned long tstamp = 0;
+#endif /* NRF70_TX_LATENCY_STATS */
+
+	if (!nrf_wifi_utils_q_len(pend_pkt_q)) {
+		return NULL;
+	}
 
+#ifdef NRF70_TX_LATENCY_STATS
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
 
-	max_txq_len = sys_fpriv->data_config.max_tx_aggregation;
-	avail_ampdu_len_per_token = sys_fpriv->avail_ampdu_len_per_token;
-
-#ifdef NRF70_RAW_DATA_TX
-	/* Check for Raw packets first, if not found, then check for
-	 * regular packets.
-	 */
-	pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][ac];
-	if (!(nrf_wifi_utils_q_len(pend_pkt_q) > 0 &&
-		  nrf_wifi_osal_nbuf_is_raw_tx(nrf_wifi_utils_q_peek(pend_pkt_q))))
-#endif
-	{
-		peer_id = tx_curr_peer_opp_get(fmac_dev_ctx, ac);
+	tstamp = tx_pend_q_tstamp_pop(fmac_dev_ctx, peer_id, ac);
 
-		/* No pending frames for any peer in that AC. */
-		if (peer_id == -1) {
-			return 0;
-		}
+	sys_dev_ctx->tx_config.desc_enq_tstamp_p[(desc *
+		sys_fpriv->data_config.max_tx_aggregation) + frame] = tstamp;
+#elif defined(NRF70_TX_AQM)
+	tx_pend_q_tstamp_pop(fmac_dev_ctx, peer_id, ac);
+#endif /* NRF70_TX_LATENCY_STATS */
 
-		pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
-	}
+	return nrf_wifi_utils_q_dequeue(pend_pkt_q);
+}
 
-	if (nrf_wifi_utils_q_len(pend_pkt_q) == 0) {
-		return 0;
-	}
 
-	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
-	txq = pkt_info->pkt;
+#ifdef NRF70_TX_AQM
+static bool tx_aqm_time_after_eq(unsigned long a,
+				 unsigned long b)
+{
+	return (long)(a - b) >= 0;
+}
 
-	/* Aggregate Only MPDU's with same RA, same Rate,
-	 * same Rate flags, same Tx Info flags
-	 */
-	if (nrf_wifi_utils_q_len(pend_pkt_q)) {
-		first_nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
-	}
 
-	while (nrf_wifi_utils_q_len(pend_pkt_q)) {
-		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+static unsigned int tx_aqm_isqrt(unsigned int val)
+{
+	unsigned int res = 0;
+	unsigned int bit = 1U << 30;
 
-		ampdu_len += TX_BUF_HEADROOM +
-			nrf_wifi_osal_nbuf_data_size((void *)nwb);
+	while (bit > val) {
+		bit >>= 2;
+	}
 
-		if (ampdu_len >= avail_ampdu_len_per_token) {
-			break;
+	while (bit) {
+		if (val >= res + bit) {
+			val -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
 		}
+		bit >>= 2;
+	}
 
-		if (!can_xmit(fmac_dev_ctx, nwb) ||
-			(!tx_aggr_check(fmac_dev_ctx, first_nwb, ac, peer_id)) ||
-			(nrf_wifi_utils_q_len(txq) >= max_txq_len)) {
-			break;
-		}
+	return res;
+}
 
-		nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
 
-		nrf_wifi_utils_list_add_tail(txq,
-					     nwb);
-	}
+static unsigned long tx_aqm_control_law(unsigned long t,
+					unsigned int count)
+{
+	return t + (NRF70_TX_AQM_INTERVAL_US / tx_aqm_isqrt(count ? count : 1));
+}
 
-	/* If our criterion rejects all pending frames, or
-	 * pend_q is empty, send only 1
-	 */
-	if (!nrf_wifi_utils_q_len(txq)) {
-		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
 
-		if (!nwb || !can_xmit(fmac_dev_ctx, nwb)) {
-			return 0;
-		}
+/* Set the ECN CE codepoint on an ECN capable IPv4/IPv6 frame.
+ * Returns false if the frame is not ECN capable.
+ */
+static bool tx_aqm_ecn_mark(void *nwb)
+{
+	unsigned char *data = NULL;
+	unsigned char *ip_hdr = NULL;
+	unsigned int len = 0;
+	unsigned int csum = 0;
+	unsigned short old_word = 0;
+	unsigned short new_word = 0;
 
-		nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
+	data = nrf_wifi_osal_nbuf_data_get(nwb);
+	len = nrf_wifi_osal_nbuf_data_size(nwb);
+	ip_hdr = data + NRF_WIFI_FMAC_ETH_HDR_LEN;
 
-		nrf_wifi_utils_list_add_tail(txq,
-					     nwb);
+	if (len < NRF_WIFI_FMAC_ETH_HDR_LEN + NRF_WIFI_FMAC_IPV4_HDR_MIN_LEN) {
+		return false;
 	}
 
-	len = nrf_wifi_utils_q_len(txq);
+	switch (nrf_wifi_util_tx_get_eth_type(data)) {
+	case NRF_WIFI_FMAC_ETH_P_IP:
+		if ((ip_hdr[1] & NRF_WIFI_FMAC_IP_ECN_MASK) == NRF_WIFI_FMAC_IP_ECN_NOT_ECT) {
+			return false;
+		}
 
-	if (len > 0) {
-		sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
-	}
+		if ((ip_hdr[1] & NRF_WIFI_FMAC_IP_ECN_MASK) == NRF_WIFI_FMAC_IP_ECN_CE) {
+			return true;
+		}
 
-	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
+		old_word = (ip_hdr[0] << 8) | ip_hdr[1];
+		ip_hdr[1] |= NRF_WIFI_FMAC_IP_ECN_CE;
+		new_word = (ip_hdr[0] << 8) | ip_hdr[1];
+
+		/* Incremental header checksum update (RFC 1624) */
+		csum = (ip_hdr[10] << 8) | ip_hdr[11];
+		csum = (~csum & 0xFFFF) + (~old_word & 0xFFFF) + new_word;
+		csum = (csum & 0xFFFF) + (csum >> 16);
+		csum = (csum & 0xFFFF) + (csum >> 16);
+		csum = ~csum & 0xFFFF;
+
+		ip_hdr[10] = csum >> 8;
+		ip_hdr[11] = csum & 0xFF;
+		return true;
+	case NRF_WIFI_FMAC_ETH_P_IPV6:
+		/* Traffic class straddles the first two bytes, ECN is bits 4-5 of byte 1 */
+		if (((ip_hdr[1] >> 4) & NRF_WIFI_FMAC_IP_ECN_MASK) == NRF_WIFI_FMAC_IP_ECN_NOT_ECT) {
+			return false;
+		}
+
+		ip_hdr[1] |= (NRF_WIFI_FMAC_IP_ECN_CE << 4);
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+/* Run CoDel on the head of a pending queue before a TX descriptor is
+ * filled from it. Frames are aggregated from the head, and the head frame has
+ * the longest sojourn time of the batch, so it is the one that is judged.
+ * Dropped frames are freed here; ECN capable frames are marked instead.
+ * Raw TX frames carry no IP header to mark and share the group queue, so
+ * the queue is left alone once one of them is at the head.
+ */
+static void tx_aqm_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			   void *pend_pkt_q,
+			   unsigned int peer_id,
+			   unsigned int ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_tx_aqm_state *aqm = NULL;
+	struct nrf_wifi_tx_aqm_stats *stats = NULL;
+	unsigned long now = 0;
+	unsigned int sojourn = 0;
+	unsigned int delta = 0;
+	bool ok_to_drop = false;
+	bool dropped = false;
+	void *nwb = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	aqm = &sys_dev_ctx->tx_config.aqm[peer_id][ac];
+	stats = &sys_dev_ctx->tx_config.aqm_stats[peer_id][ac];
+
+	while (nrf_wifi_utils_q_len(pend_pkt_q)) {
+		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+
+		if (is_twt_emergency_pkt(nwb)) {
+			break;
+		}
+
+#ifdef NRF70_RAW_DATA_TX
+		if (nrf_wifi_osal_nbuf_is_raw_tx(nwb)) {
+			break;
+		}
+#endif /* NRF70_RAW_DATA_TX */
+
+		now = nrf_wifi_osal_time_get_curr_us();
+		sojourn = now - tx_pend_q_tstamp_peek(fmac_dev_ctx, peer_id, ac);
+
+		if (sojourn > stats->max_sojourn_us) {
+			stats->max_sojourn_us = sojourn;
+		}
+
+		ok_to_drop = false;
+
+		if (sojourn < NRF70_TX_AQM_TARGET_US ||
+		    nrf_wifi_utils_q_len(pend_pkt_q) <= 1) {
+			aqm->first_above_time = 0;
+		} else if (!aqm->first_above_time) {
+			aqm->first_above_time = now + NRF70_TX_AQM_INTERVAL_US;
+			if (!aqm->first_above_time) {
+				aqm->first_above_time = 1;
+			}
+		} else if (tx_aqm_time_after_eq(now, aqm->first_above_time)) {
+			ok_to_drop = true;
+		}
+
+		if (aqm->dropping) {
+			if (!ok_to_drop) {
+				aqm->dropping = false;
+				break;
+			}
+
+			if (!tx_aqm_time_after_eq(now, aqm->drop_next)) {
+				break;
+			}
+
+			aqm->count++;
+			aqm->drop_next = tx_aqm_control_law(aqm->drop_next, aqm->count);
+		} else if (ok_to_drop) {
+			aqm->dropping = true;
+
+			delta = aqm->count - aqm->lastcount;
+
+			if ((delta > 1) &&
+			    !tx_aqm_time_after_eq(now,
+						  aqm->drop_next + (16 * NRF70_TX_AQM_INTERVAL_US))) {
+				aqm->count = delta;
+			} else {
+				aqm->count = 1;
+			}
+
+			aqm->lastcount = aqm->count;
+			aqm->drop_next = tx_aqm_control_law(now, aqm->count);
+		} else {
+			break;
+		}
+
+		if (tx_aqm_ecn_mark(nwb)) {
+			stats->marks++;
+			break;
+		}
+
+		tx_pend_q_tstamp_pop(fmac_dev_ctx, peer_id, ac);
+		nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
+#ifdef NRF70_RAW_TX_BATCH
+		raw_tx_batch_frms_done(fmac_dev_ctx,
+				       raw_tx_batch_tag_get(nwb),
+				       1,
+				       true);
+#endif /* NRF70_RAW_TX_BATCH */
+		nrf_wifi_osal_nbuf_free(nwb);
+
+		stats->drops++;
+		sys_dev_ctx->host_stats.total_tx_drop_pkts++;
+		dropped = true;
+	}
+
+	if (dropped) {
+		update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
+	}
+}
+#endif /* NRF70_TX_AQM */
+
+
+static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			unsigned int desc,
+			unsigned int ac)
+{
+	int len = 0;
+	void *pend_pkt_q = NULL;
+	void *txq = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	int peer_id = -1;
+	void *nwb = NULL;
+	void *first_nwb = NULL;
+
+	int max_txq_len, avail_ampdu_len_per_token;
+	int ampdu_len = 0;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned int q_peer_id = MAX_PEERS;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	max_txq_len = sys_fpriv->data_config.max_tx_aggregation;
+	avail_ampdu_len_per_token = sys_fpriv->avail_ampdu_len_per_token;
+
+#ifdef NRF70_RAW_DATA_TX
+	/* Check for Raw packets first, if not found, then check for
+	 * regular packets.
+	 */
+	pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][ac];
+	if (!(nrf_wifi_utils_q_len(pend_pkt_q) > 0 &&
+		  nrf_wifi_osal_nbuf_is_raw_tx(nrf_wifi_utils_q_peek(pend_pkt_q))))
+#endif
+	{
+		peer_id = tx_curr_peer_opp_get(fmac_dev_ctx, ac);
+
+		/* No pending frames for any peer in that AC. */
+		if (peer_id == -1) {
+			return 0;
+		}
+
+		pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
+		q_peer_id = peer_id;
+	}
+
+#ifdef NRF70_TX_AQM
+	tx_aqm_process(fmac_dev_ctx, pend_pkt_q, q_peer_id, ac);
+#endif /* NRF70_TX_AQM */
+
+	if (nrf_wifi_utils_q_len(pend_pkt_q) == 0) {
+		return 0;
+	}
+
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+	txq = pkt_info->pkt;
+
+	/* Aggregate Only MPDU's with same RA, same Rate,
+	 * same Rate flags, same Tx Info flags
+	 */
+	if (nrf_wifi_utils_q_len(pend_pkt_q)) {
+		first_nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+	}
+
+	while (nrf_wifi_utils_q_len(pend_pkt_q)) {
+		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+
+		ampdu_len += TX_BUF_HEADROOM +
+			nrf_wifi_osal_nbuf_data_size((void *)nwb);
+
+		if (ampdu_len >= avail_ampdu_len_per_token) {
+			break;
+		}
+
+		if (!can_xmit(fmac_dev_ctx, nwb) ||
+			(!tx_aggr_check(fmac_dev_ctx, first_nwb, ac, peer_id)) ||
+			(nrf_wifi_utils_q_len(txq) >= max_txq_len)) {
+			break;
+		}
+
+		nwb = tx_pend_q_dequeue(fmac_dev_ctx, pend_pkt_q, q_peer_id, ac,
+					desc, nrf_wifi_utils_q_len(txq));
+
+		nrf_wifi_utils_list_add_tail(txq,
+					     nwb);
+	}
+
+	/* If our criterion rejects all pending frames, or
+	 * pend_q is empty, send only 1
+	 */
+	if (!nrf_wifi_utils_q_len(txq)) {
+		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+
+		if (!nwb || !can_xmit(fmac_dev_ctx, nwb)) {
+			return 0;
+		}
+
+		nwb = tx_pend_q_dequeue(fmac_dev_ctx, pend_pkt_q, q_peer_id, ac,
+					desc, 0);
+
+		nrf_wifi_utils_list_add_tail(txq,
+					     nwb);
+	}
+
+	len = nrf_wifi_utils_q_len(txq);
+
+	if (len > 0) {
+		sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF_WIFI_RPU_FAST_RECOVERY)
+		sys_dev_ctx->tx_config.pkt_info_p[desc].ac = ac;
+#endif /* NRF70_TX_LATENCY_STATS || NRF_WIFI_RPU_FAST_RECOVERY */
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		sys_dev_ctx->tx_config.pkt_info_p[desc].send_seq =
+			sys_dev_ctx->tx_config.send_seq++;
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+	}
+
+	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
 
 	return len;
 }
@@ -1021,6 +1583,35 @@ err:
 	return NRF_WIFI_STATUS_FAIL;
 }
 
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+/* Number of completed TX frames handed back to the OS in one call */
+#define TX_FREE_BULK 8
+
+struct tx_free_bulk {
+	void *nwbs[TX_FREE_BULK];
+	unsigned int num_nwbs;
+};
+
+
+static void tx_free_bulk_flush(struct tx_free_bulk *bulk)
+{
+	nrf_wifi_osal_nbuf_free_bulk(bulk->nwbs,
+				     bulk->num_nwbs);
+	bulk->num_nwbs = 0;
+}
+
+
+static void tx_free_bulk_add(struct tx_free_bulk *bulk,
+			     void *nwb)
+{
+	bulk->nwbs[bulk->num_nwbs++] = nwb;
+
+	if (bulk->num_nwbs == TX_FREE_BULK) {
+		tx_free_bulk_flush(bulk);
+	}
+}
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
 #ifdef NRF70_RAW_DATA_TX
 enum nrf_wifi_status rawtx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				    void *txq,
@@ -1032,9 +1623,24 @@ enum nrf_wifi_status rawtx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	unsigned int len = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	void *nwb = NULL;
+#ifdef NRF70_RAW_TX_BATCH
+	unsigned char tag = 0;
+#endif /* NRF70_RAW_TX_BATCH */
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	struct tx_free_bulk free_bulk = {0};
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
+#ifdef NRF70_RAW_TX_BATCH
+	tag = raw_tx_batch_tag_get(nrf_wifi_utils_list_peek(txq));
+	sys_dev_ctx->tx_config.pkt_info_p[desc].raw_tx_batch = tag;
+
+	if (tag) {
+		sys_dev_ctx->raw_tx_batch_stats.num_cmds++;
+	}
+
+#endif /* NRF70_RAW_TX_BATCH */
 	len += sizeof(struct nrf_wifi_cmd_raw_tx);
 	len *= nrf_wifi_utils_list_len(txq);
 
@@ -1047,6 +1653,15 @@ enum nrf_wifi_status rawtx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				   desc,
 				   txq,
 				   peer_id);
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) && !defined(NRF71_ON_IPC)
+
+	/* The frames have to reach the RPU before the command does */
+	if (nrf_wifi_sys_hal_buf_map_tx_wait(fmac_dev_ctx->hal_dev_ctx) !=
+	    NRF_WIFI_STATUS_SUCCESS) {
+		status = NRF_WIFI_STATUS_FAIL;
+	}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER && !NRF71_ON_IPC */
+
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: rawtx_cmd_prepare failed",
 				      __func__);
@@ -1058,6 +1673,21 @@ enum nrf_wifi_status rawtx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					    umac_cmd,
 					    (sizeof(*umac_cmd) + len));
 
+#ifdef NRF70_TX_LATENCY_STATS
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		tx_lat_post(fmac_dev_ctx, desc, nrf_wifi_utils_q_len(txq));
+	}
+#endif /* NRF70_TX_LATENCY_STATS */
+#ifdef NRF70_RAW_TX_BATCH
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		raw_tx_batch_frms_done(fmac_dev_ctx,
+				       tag,
+				       nrf_wifi_utils_q_len(txq),
+				       true);
+		sys_dev_ctx->tx_config.pkt_info_p[desc].raw_tx_batch = 0;
+	}
+#endif /* NRF70_RAW_TX_BATCH */
+
 	while (nrf_wifi_utils_q_len(txq)) {
 		nwb = nrf_wifi_utils_q_dequeue(txq);
 
@@ -1065,8 +1695,28 @@ enum nrf_wifi_status rawtx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			continue;
 		}
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		/* Keep the frame until TX done, so that it can be requeued
+		 * if the RPU is recovered before completing it.
+		 */
+		if ((status == NRF_WIFI_STATUS_SUCCESS) &&
+		    (nrf_wifi_utils_q_enqueue(sys_dev_ctx->tx_config.pkt_info_p[desc].sent,
+					      nwb) == NRF_WIFI_STATUS_SUCCESS)) {
+			continue;
+		}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+		tx_free_bulk_add(&free_bulk,
+				 nwb);
+#else
 		nrf_wifi_osal_nbuf_free(nwb);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 	}
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	tx_free_bulk_flush(&free_bulk);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 out:
 	return status;
 }
@@ -1081,6 +1731,12 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	struct host_rpu_msg *umac_cmd = NULL;
 	unsigned int len = 0;
 	void *nwb = NULL;
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	struct tx_free_bulk free_bulk = {0};
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 
 	len += sizeof(struct nrf_wifi_tx_buff_info);
 	len *= nrf_wifi_utils_list_len(txq);
@@ -1096,6 +1752,14 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				desc,
 				txq,
 				peer_id);
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) && !defined(NRF71_ON_IPC)
+
+	/* The frames have to reach the RPU before the command does */
+	if (nrf_wifi_sys_hal_buf_map_tx_wait(fmac_dev_ctx->hal_dev_ctx) !=
+	    NRF_WIFI_STATUS_SUCCESS) {
+		status = NRF_WIFI_STATUS_FAIL;
+	}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER && !NRF71_ON_IPC */
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: tx_cmd_prepare failed",
@@ -1111,6 +1775,12 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						desc,
 						0);
 
+#ifdef NRF70_TX_LATENCY_STATS
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		tx_lat_post(fmac_dev_ctx, desc, nrf_wifi_utils_q_len(txq));
+	}
+#endif /* NRF70_TX_LATENCY_STATS */
+
 	nrf_wifi_osal_mem_free(umac_cmd);
 
 	while (nrf_wifi_utils_q_len(txq)) {
@@ -1120,8 +1790,28 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			continue;
 		}
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		/* Keep the frame until TX done, so that it can be requeued
+		 * if the RPU is recovered before completing it.
+		 */
+		if ((status == NRF_WIFI_STATUS_SUCCESS) &&
+		    (nrf_wifi_utils_q_enqueue(sys_dev_ctx->tx_config.pkt_info_p[desc].sent,
+					      nwb) == NRF_WIFI_STATUS_SUCCESS)) {
+			continue;
+		}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+		tx_free_bulk_add(&free_bulk,
+				 nwb);
+#else
 		nrf_wifi_osal_nbuf_free(nwb);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 	}
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	tx_free_bulk_flush(&free_bulk);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 out:
 	return status;
 }
@@ -1201,9 +1891,16 @@ static enum nrf_wifi_status tx_enqueue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ct
 	qlen = nrf_wifi_utils_q_len(queue);
 
 	if (qlen >= NRF70_MAX_TX_PENDING_QLEN) {
+#ifdef NRF70_TX_AQM
+		sys_dev_ctx->tx_config.aqm_stats[peer_id][ac].tail_drops++;
+#endif /* NRF70_TX_AQM */
 		goto out;
 	}
 
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF70_TX_AQM)
+	tx_pend_q_tstamp_push(fmac_dev_ctx, peer_id, ac, is_twt_emergency_pkt(nwb));
+#endif /* NRF70_TX_LATENCY_STATS || NRF70_TX_AQM */
+
 	if (is_twt_emergency_pkt(nwb)) {
 		nrf_wifi_utils_q_enqueue_head(queue,
 					      nwb);
@@ -1370,6 +2067,42 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+static void tx_sent_frames_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				unsigned int desc)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	void *sent = NULL;
+	void *nwb = NULL;
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	struct tx_free_bulk free_bulk = {0};
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sent = sys_dev_ctx->tx_config.pkt_info_p[desc].sent;
+
+	while (nrf_wifi_utils_q_len(sent)) {
+		nwb = nrf_wifi_utils_q_dequeue(sent);
+
+		if (!nwb) {
+			continue;
+		}
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+		tx_free_bulk_add(&free_bulk,
+				 nwb);
+#else
+		nrf_wifi_osal_nbuf_free(nwb);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+	}
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+	tx_free_bulk_flush(&free_bulk);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+
 static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				     unsigned char tx_desc_num)
 {
@@ -1402,6 +2135,10 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	tx_sent_frames_free(fmac_dev_ctx, desc);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
 	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
 
 	for (frame = 0;
@@ -1539,6 +2276,10 @@ enum nrf_wifi_status nrf_wifi_fmac_rawtx_done_event_process(
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+#ifdef NRF70_RAW_TX_BATCH
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+#endif /* NRF70_RAW_TX_BATCH */
 
 	if (!fmac_dev_ctx || !config) {
 		nrf_wifi_osal_log_err("%s: Invalid parameters",
@@ -1554,6 +2295,10 @@ enum nrf_wifi_status nrf_wifi_fmac_rawtx_done_event_process(
 		return NRF_WIFI_STATUS_SUCCESS;
 	}
 
+#ifdef NRF70_RAW_TX_BATCH
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+#endif /* NRF70_RAW_TX_BATCH */
 	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
 
 	if (config->status == NRF_WIFI_STATUS_FAIL) {
@@ -1564,6 +2309,22 @@ enum nrf_wifi_status nrf_wifi_fmac_rawtx_done_event_process(
 		sys_dev_ctx->raw_pkt_stats.raw_pkt_send_failure += 1;
 	}
 
+#ifdef NRF70_TX_LATENCY_STATS
+	tx_lat_done(fmac_dev_ctx, config->desc_num, NULL, NULL);
+#endif /* NRF70_TX_LATENCY_STATS */
+#ifdef NRF70_RAW_TX_BATCH
+	/* Before the descriptor gets reused for the pending frames */
+	if (config->desc_num < sys_fpriv->num_tx_tokens) {
+		pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[config->desc_num];
+
+		raw_tx_batch_frms_done(fmac_dev_ctx,
+				       pkt_info->raw_tx_batch,
+				       sys_dev_ctx->tx_config.send_pkt_coalesce_count_p[config->desc_num],
+				       config->status == NRF_WIFI_STATUS_FAIL);
+		pkt_info->raw_tx_batch = 0;
+	}
+#endif /* NRF70_RAW_TX_BATCH */
+
 	status = tx_done_process(fmac_dev_ctx,
 				 config->desc_num);
 
@@ -1574,6 +2335,10 @@ enum nrf_wifi_status nrf_wifi_fmac_rawtx_done_event_process(
 	}
 unlock:
 	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#ifdef NRF70_RAW_TX_BATCH
+
+	raw_tx_batch_report(fmac_dev_ctx);
+#endif /* NRF70_RAW_TX_BATCH */
 out:
 	return status;
 }
@@ -1603,10 +2368,22 @@ enum nrf_wifi_status (nrf_wifi_fmac_tx_done_event_process)(
 
 	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
 
+#ifdef NRF70_TX_LATENCY_STATS
+	tx_lat_done(fmac_dev_ctx,
+		    config->tx_desc_num,
+		    config->timestamp_t1,
+		    config->timestamp_t4);
+#endif /* NRF70_TX_LATENCY_STATS */
+
 	status = tx_done_process(fmac_dev_ctx,
 				 config->tx_desc_num);
 
 	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#ifdef NRF70_RAW_TX_BATCH
+
+	/* Raw frames may have been dropped while refilling the descriptor */
+	raw_tx_batch_report(fmac_dev_ctx);
+#endif /* NRF70_RAW_TX_BATCH */
 
 out:
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
@@ -1653,6 +2430,13 @@ static enum nrf_wifi_fmac_tx_status nrf_wifi_fmac_tx(struct nrf_wifi_fmac_dev_ct
 
 	status = NRF_WIFI_FMAC_TX_STATUS_QUEUED;
 
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	/* Frames are sent once the RPU is back up */
+	if (sys_dev_ctx->recovery.in_progress) {
+		goto out;
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
 	if (!can_xmit(fmac_dev_ctx, nbuf)) {
 		goto out;
 	}
@@ -1668,6 +2452,10 @@ static enum nrf_wifi_fmac_tx_status nrf_wifi_fmac_tx(struct nrf_wifi_fmac_dev_ct
 					ac);
 out:
 	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#ifdef NRF70_RAW_TX_BATCH
+
+	raw_tx_batch_report(fmac_dev_ctx);
+#endif /* NRF70_RAW_TX_BATCH */
 
 	return status;
 }
@@ -1690,6 +2478,10 @@ enum nrf_wifi_status tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 	sys_fpriv = wifi_fmac_priv(fpriv);
 
+#ifdef NRF70_TX_FLOW_CACHE
+	nrf_wifi_fmac_tx_flow_cache_flush(fmac_dev_ctx);
+
+#endif /* NRF70_TX_FLOW_CACHE */
 	sys_dev_ctx->tx_config.send_pkt_coalesce_count_p =
 		nrf_wifi_osal_mem_zalloc((sizeof(unsigned int) *
 					  sys_fpriv->num_tx_tokens));
@@ -1735,6 +2527,17 @@ enum nrf_wifi_status tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 					      __func__);
 			goto tx_q_setup_free;
 		}
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+
+		sys_dev_ctx->tx_config.pkt_info_p[i].sent = nrf_wifi_utils_list_alloc();
+
+		if (!sys_dev_ctx->tx_config.pkt_info_p[i].sent) {
+			nrf_wifi_osal_log_err("%s: Unable to allocate sent list",
+					      __func__);
+			nrf_wifi_utils_list_free(sys_dev_ctx->tx_config.pkt_info_p[i].pkt);
+			goto tx_q_setup_free;
+		}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 	}
 
 	for (j = 0; j < NRF_WIFI_FMAC_AC_MAX; j++) {
@@ -1811,6 +2614,9 @@ tx_buff_map_free:
 tx_pkt_info_free:
 	for (i = 0; i < sys_fpriv->num_tx_tokens; i++) {
 		nrf_wifi_utils_list_free(sys_dev_ctx->tx_config.pkt_info_p[i].pkt);
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+		nrf_wifi_utils_list_free(sys_dev_ctx->tx_config.pkt_info_p[i].sent);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 	}
 tx_q_setup_free:
 	nrf_wifi_osal_mem_free(sys_dev_ctx->tx_config.pkt_info_p);
@@ -1861,6 +2667,10 @@ void tx_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 			}
 			nrf_wifi_utils_list_free(
 						 sys_dev_ctx->tx_config.pkt_info_p[i].pkt);
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+			tx_sent_frames_free(fmac_dev_ctx, i);
+			nrf_wifi_utils_list_free(sys_dev_ctx->tx_config.pkt_info_p[i].sent);
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
 		}
 	}
 
@@ -1885,14 +2695,276 @@ void tx_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 }
 
 
-static int map_ac_from_tid(int tid)
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+/* Moves the frames in frames to the tail of pend_pkt_q, frames which do not
+ * fit are freed. Returns the number of frames moved.
+ */
+static unsigned int tx_recovery_frames_move(void *pend_pkt_q,
+					    void *frames)
 {
-	const int map_1d_to_ac[8] = {
-		NRF_WIFI_FMAC_AC_BE, /*UP 0, 802.1D(BE), AC(BE) */
-		NRF_WIFI_FMAC_AC_BK, /*UP 1, 802.1D(BK), AC(BK) */
-		NRF_WIFI_FMAC_AC_BK, /*UP 2, 802.1D(BK), AC(BK) */
-		NRF_WIFI_FMAC_AC_BE, /*UP 3, 802.1D(EE), AC(BE) */
-		NRF_WIFI_FMAC_AC_VI, /*UP 4, 802.1D(CL), AC(VI) */
+	void *nwb = NULL;
+	unsigned int cnt = 0;
+
+	while (nrf_wifi_utils_q_len(frames)) {
+		nwb = nrf_wifi_utils_q_dequeue(frames);
+
+		if (!nwb) {
+			continue;
+		}
+
+		if ((nrf_wifi_utils_q_len(pend_pkt_q) >= NRF70_MAX_TX_PENDING_QLEN) ||
+		    (nrf_wifi_utils_q_enqueue(pend_pkt_q, nwb) != NRF_WIFI_STATUS_SUCCESS)) {
+			nrf_wifi_osal_nbuf_free(nwb);
+			continue;
+		}
+
+		cnt++;
+	}
+
+	return cnt;
+}
+
+
+/* Frees the frames in frames, returns the number of frames freed. */
+static unsigned int tx_recovery_frames_drop(void *frames)
+{
+	void *nwb = NULL;
+	unsigned int cnt = 0;
+
+	while (nrf_wifi_utils_q_len(frames)) {
+		nwb = nrf_wifi_utils_q_dequeue(frames);
+
+		if (!nwb) {
+			continue;
+		}
+
+		nrf_wifi_osal_nbuf_free(nwb);
+		cnt++;
+	}
+
+	return cnt;
+}
+
+
+/* Returns the descriptor which was filled last among the ones which still
+ * hold frames, num_tx_tokens if there are none.
+ */
+static unsigned int tx_recovery_newest_desc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	unsigned int newest = 0;
+	unsigned int desc = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	newest = sys_fpriv->num_tx_tokens;
+
+	for (desc = 0; desc < sys_fpriv->num_tx_tokens; desc++) {
+		pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+		if (!nrf_wifi_utils_q_len(pkt_info->sent) &&
+		    !nrf_wifi_utils_q_len(pkt_info->pkt)) {
+			continue;
+		}
+
+		/* Compare the distance from the next sequence number, so that
+		 * the order holds across a wrap around.
+		 */
+		if ((newest == sys_fpriv->num_tx_tokens) ||
+		    ((sys_dev_ctx->tx_config.send_seq - pkt_info->send_seq) <
+		     (sys_dev_ctx->tx_config.send_seq -
+		      sys_dev_ctx->tx_config.pkt_info_p[newest].send_seq))) {
+			newest = desc;
+		}
+	}
+
+	return newest;
+}
+
+
+unsigned int tx_recovery_requeue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	void *pend_pkt_q = NULL;
+	void *nwb = NULL;
+	unsigned int desc = 0;
+	unsigned int desc_id = 0;
+	unsigned int peer_id = 0;
+	unsigned int qlen = 0;
+	unsigned int cnt = 0;
+	unsigned int dropped = 0;
+	unsigned int i = 0;
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF70_TX_AQM)
+	unsigned long now = 0;
+	unsigned int ac = 0;
+#endif /* NRF70_TX_LATENCY_STATS || NRF70_TX_AQM */
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	/* Each descriptor is put in front of its pending queue, so go from the
+	 * last filled one to the first one to keep the send order.
+	 */
+	while ((desc = tx_recovery_newest_desc(fmac_dev_ctx)) != sys_fpriv->num_tx_tokens) {
+		pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+		/* The restarted RPU does not know the unicast peers anymore */
+		if (pkt_info->peer_id < MAX_PEERS) {
+			dropped += tx_recovery_frames_drop(pkt_info->sent);
+			dropped += tx_recovery_frames_drop(pkt_info->pkt);
+#ifdef NRF70_TX_LATENCY_STATS
+			pkt_info->post_tstamp_us = 0;
+#endif /* NRF70_TX_LATENCY_STATS */
+			continue;
+		}
+
+		/* Group and raw frames are not tied to a peer and use the last queue */
+		pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][pkt_info->ac];
+		qlen = nrf_wifi_utils_q_len(pend_pkt_q);
+
+		/* The frames of the descriptor were dequeued before the ones
+		 * still pending, so put them back in front of those.
+		 */
+		cnt += tx_recovery_frames_move(pend_pkt_q, pkt_info->sent);
+		cnt += tx_recovery_frames_move(pend_pkt_q, pkt_info->pkt);
+
+		while (qlen--) {
+			nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
+
+			if (nrf_wifi_utils_q_enqueue(pend_pkt_q, nwb) != NRF_WIFI_STATUS_SUCCESS) {
+				nrf_wifi_osal_nbuf_free(nwb);
+			}
+		}
+#ifdef NRF70_TX_LATENCY_STATS
+		pkt_info->post_tstamp_us = 0;
+#endif /* NRF70_TX_LATENCY_STATS */
+	}
+
+	for (peer_id = 0; peer_id < MAX_PEERS; peer_id++) {
+		for (i = 0; i < NRF_WIFI_FMAC_AC_MAX; i++) {
+			dropped += tx_recovery_frames_drop(
+				sys_dev_ctx->tx_config.data_pending_txq[peer_id][i]);
+		}
+
+		sys_dev_ctx->tx_config.peers[peer_id].pend_q_bmp = 0;
+	}
+
+	sys_dev_ctx->recovery.num_dropped_frames += dropped;
+
+	/* The restarted RPU has no descriptors outstanding */
+	for (desc_id = 0;
+	     desc_id < (sys_fpriv->num_tx_tokens * sys_fpriv->data_config.max_tx_aggregation);
+	     desc_id++) {
+		if (!sys_dev_ctx->tx_buf_info[desc_id].mapped) {
+			continue;
+		}
+#ifndef NRF71_ON_IPC
+		nrf_wifi_sys_hal_buf_unmap_tx(fmac_dev_ctx->hal_dev_ctx,
+					      desc_id);
+#endif /* !NRF71_ON_IPC */
+		sys_dev_ctx->tx_buf_info[desc_id].nwb = 0;
+		sys_dev_ctx->tx_buf_info[desc_id].mapped = false;
+	}
+
+	nrf_wifi_osal_mem_set(sys_dev_ctx->tx_config.buf_pool_bmp_p,
+			      0,
+			      sizeof(long)*((sys_fpriv->num_tx_tokens/TX_DESC_BUCKET_BOUND) + 1));
+
+	nrf_wifi_osal_mem_set(sys_dev_ctx->tx_config.send_pkt_coalesce_count_p,
+			      0,
+			      sizeof(unsigned int) * sys_fpriv->num_tx_tokens);
+
+	for (i = 0; i < NRF_WIFI_FMAC_AC_MAX; i++) {
+		sys_dev_ctx->tx_config.outstanding_descs[i] = 0;
+	}
+
+	sys_dev_ctx->tx_config.spare_desc_queue_map = 0;
+
+#if defined(NRF70_TX_LATENCY_STATS) || defined(NRF70_TX_AQM)
+	/* Requeued frames have no enqueue timestamp, restart the queue
+	 * delays from now.
+	 */
+	now = nrf_wifi_osal_time_get_curr_us();
+
+	for (i = 0; i < MAX_SW_PEERS; i++) {
+		for (ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+			sys_dev_ctx->tx_config.pend_q_tstamp_head[i][ac] = 0;
+
+			for (qlen = 0; qlen < NRF70_MAX_TX_PENDING_QLEN; qlen++) {
+				sys_dev_ctx->tx_config.pend_q_tstamp[i][ac][qlen] = now;
+			}
+		}
+	}
+#endif /* NRF70_TX_LATENCY_STATS || NRF70_TX_AQM */
+
+#ifdef NRF70_TX_AQM
+	nrf_wifi_osal_mem_set(sys_dev_ctx->tx_config.aqm,
+			      0,
+			      sizeof(sys_dev_ctx->tx_config.aqm));
+#endif /* NRF70_TX_AQM */
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	return cnt;
+}
+
+
+void tx_recovery_resume(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned long *buf_pool_bmp = NULL;
+	unsigned int desc = 0;
+	unsigned int ac = 0;
+	unsigned int cnt = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	buf_pool_bmp = sys_dev_ctx->tx_config.buf_pool_bmp_p;
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	for (ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+		for (cnt = 0; cnt < sys_fpriv->num_tx_tokens; cnt++) {
+			desc = tx_desc_get(fmac_dev_ctx, ac);
+
+			if (desc == sys_fpriv->num_tx_tokens) {
+				break;
+			}
+
+			if (tx_pending_process(fmac_dev_ctx,
+					       desc,
+					       ac) != NRF_WIFI_STATUS_SUCCESS) {
+				break;
+			}
+
+			/* The descriptor is released when there was nothing to send */
+			if (!(buf_pool_bmp[desc / TX_DESC_BUCKET_BOUND] &
+			      (1 << (desc % TX_DESC_BUCKET_BOUND)))) {
+				break;
+			}
+		}
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+
+static int map_ac_from_tid(int tid)
+{
+	const int map_1d_to_ac[8] = {
+		NRF_WIFI_FMAC_AC_BE, /*UP 0, 802.1D(BE), AC(BE) */
+		NRF_WIFI_FMAC_AC_BK, /*UP 1, 802.1D(BK), AC(BK) */
+		NRF_WIFI_FMAC_AC_BK, /*UP 2, 802.1D(BK), AC(BK) */
+		NRF_WIFI_FMAC_AC_BE, /*UP 3, 802.1D(EE), AC(BE) */
+		NRF_WIFI_FMAC_AC_VI, /*UP 4, 802.1D(CL), AC(VI) */
 		NRF_WIFI_FMAC_AC_VI, /*UP 5, 802.1D(VI), AC(VI) */
 		NRF_WIFI_FMAC_AC_VO, /*UP 6, 802.1D(VO), AC(VO) */
 		NRF_WIFI_FMAC_AC_VO  /*UP 7, 802.1D(NC), AC(VO) */
@@ -1913,6 +2985,79 @@ static int get_ac(unsigned int tid,
 }
 
 
+/* Map a frame to the peer and access category it is to be sent on.
+ * Returns the peer ID, or -1 if the frame is for an unknown peer.
+ */
+static int tx_classify(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+		       unsigned char if_idx,
+		       void *nbuf,
+		       int *ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned char *ra = NULL;
+	int tid = 0;
+	int peer_id = -1;
+#ifdef NRF70_TX_FLOW_CACHE
+	struct nrf_wifi_tx_flow_cache *cache = NULL;
+	struct nrf_wifi_tx_flow *flow = NULL;
+	unsigned char *dst = NULL;
+	unsigned int gen = 0;
+#endif /* NRF70_TX_FLOW_CACHE */
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	tid = nrf_wifi_get_tid(nbuf);
+
+#ifdef NRF70_TX_FLOW_CACHE
+	cache = &sys_dev_ctx->tx_config.flow_cache;
+	/* A flush during the classification below makes the result stale */
+	gen = cache->gen;
+	dst = nrf_wifi_get_dest(nbuf);
+	flow = &cache->flows[(dst[NRF_WIFI_FMAC_ETH_ADDR_LEN - 1] ^ tid ^ if_idx) &
+			     (NRF70_TX_FLOW_CACHE_SIZE - 1)];
+
+	if ((flow->gen == gen) &&
+	    (flow->if_idx == if_idx) &&
+	    (flow->tid == tid) &&
+	    nrf_wifi_util_ether_addr_equal(flow->dst, dst)) {
+		*ac = flow->ac;
+		return flow->peer_id;
+	}
+#endif /* NRF70_TX_FLOW_CACHE */
+
+	ra = nrf_wifi_util_get_ra(sys_dev_ctx->vif_ctx[if_idx], nbuf);
+
+	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, ra);
+
+	if (peer_id == -1) {
+		return -1;
+	} else if (peer_id == MAX_PEERS) {
+		*ac = NRF_WIFI_FMAC_AC_MC;
+	} else {
+		if (sys_dev_ctx->tx_config.peers[peer_id].qos_supported) {
+			*ac = get_ac(tid, ra);
+		} else {
+			*ac = NRF_WIFI_FMAC_AC_BE;
+		}
+	}
+
+#ifdef NRF70_TX_FLOW_CACHE
+	/* Mark the entry stale while it is being updated */
+	flow->gen = 0;
+	nrf_wifi_osal_mem_cpy(flow->dst,
+			      dst,
+			      NRF_WIFI_FMAC_ETH_ADDR_LEN);
+	flow->if_idx = if_idx;
+	flow->tid = tid;
+	flow->peer_id = peer_id;
+	flow->ac = *ac;
+	flow->gen = gen;
+#endif /* NRF70_TX_FLOW_CACHE */
+
+	return peer_id;
+}
+
+
 #ifdef NRF70_RAW_DATA_TX
 static bool nrf_wifi_raw_pkt_mode_enabled(struct nrf_wifi_fmac_vif_ctx *vif)
 {
@@ -1975,6 +3120,11 @@ enum nrf_wifi_status nrf_wifi_fmac_start_rawpkt_xmit(void *dev_ctx,
 				      __func__);
 		goto fail;
 	}
+#ifdef NRF70_RAW_TX_BATCH
+
+	/* Not part of a batch */
+	RAW_TX_BATCH_TAG(raw_tx_hdr) = 0;
+#endif /* NRF70_RAW_TX_BATCH */
 
 	peer_id = MAX_PEERS;
 	ac = raw_tx_hdr->queue;
@@ -2014,6 +3164,238 @@ fail:
 
 	return NRF_WIFI_STATUS_FAIL;
 }
+
+#ifdef NRF70_RAW_TX_BATCH
+static enum nrf_wifi_status raw_tx_batch_frm_prep(void *nwb,
+						  struct raw_tx_pkt_header *raw_tx_hdr,
+						  unsigned char tag)
+{
+	struct raw_tx_pkt_header *hdr = NULL;
+
+	if (nrf_wifi_osal_nbuf_headroom_get(nwb) < sizeof(*raw_tx_hdr)) {
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	/* Go through the same header handling as a single raw frame */
+	hdr = nrf_wifi_osal_nbuf_data_push(nwb,
+					   sizeof(*raw_tx_hdr));
+
+	nrf_wifi_osal_mem_cpy(hdr,
+			      raw_tx_hdr,
+			      sizeof(*raw_tx_hdr));
+
+	hdr = nrf_wifi_osal_nbuf_set_raw_tx_hdr(nwb,
+						sizeof(*raw_tx_hdr));
+
+	if (!hdr) {
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	RAW_TX_BATCH_TAG(hdr) = tag;
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_start_rawpkt_xmit_batch(void *dev_ctx,
+							   unsigned char if_idx,
+							   void **nwbs,
+							   unsigned int num_nwbs,
+							   struct raw_tx_pkt_header *raw_tx_hdr,
+							   void *cookie)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_raw_tx_batch *batch = NULL;
+	void *pend_pkt_q = NULL;
+	void *nwb = NULL;
+	unsigned int desc = 0;
+	unsigned int qlen = 0;
+	unsigned int num_queued = 0;
+	unsigned int ac = 0;
+	unsigned int i = 0;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !nwbs || !num_nwbs || !raw_tx_hdr) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	sys_dev_ctx->raw_pkt_stats.raw_pkts_from_stack += num_nwbs;
+
+	if ((if_idx >= MAX_NUM_VIFS) ||
+	    !sys_dev_ctx->vif_ctx[if_idx] ||
+	    !nrf_wifi_raw_pkt_mode_enabled(sys_dev_ctx->vif_ctx[if_idx])) {
+		nrf_wifi_osal_log_err("%s: raw_packet mode is not enabled",
+				      __func__);
+		goto out;
+	}
+
+	ac = raw_tx_hdr->queue;
+
+	if (ac >= NRF_WIFI_FMAC_AC_MAX) {
+		nrf_wifi_osal_log_err("%s: Invalid access category %d",
+				      __func__,
+				      ac);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	if (sys_fpriv->num_tx_tokens == 0) {
+		goto unlock;
+	}
+
+	for (i = 0; i < NRF70_RAW_TX_BATCH_SLOTS; i++) {
+		if (!sys_dev_ctx->raw_tx_batch[i].in_use) {
+			batch = &sys_dev_ctx->raw_tx_batch[i];
+			break;
+		}
+	}
+
+	if (!batch) {
+		sys_dev_ctx->raw_tx_batch_stats.num_no_slot++;
+		goto unlock;
+	}
+
+	nrf_wifi_osal_mem_set(batch,
+			      0,
+			      sizeof(*batch));
+	batch->cookie = cookie;
+	batch->if_idx = if_idx;
+	batch->num_frms = num_nwbs;
+	batch->in_use = true;
+
+	sys_dev_ctx->raw_tx_batch_stats.num_batches++;
+	sys_dev_ctx->raw_tx_batch_stats.num_frms += num_nwbs;
+
+	/* Queue all the frames under a single lock hold */
+	for (i = 0; i < num_nwbs; i++) {
+		nwb = nwbs[i];
+		nwbs[i] = NULL;
+
+		if (!nwb) {
+			batch->num_done++;
+			batch->num_failed++;
+			continue;
+		}
+
+		if ((raw_tx_batch_frm_prep(nwb,
+					   raw_tx_hdr,
+					   (unsigned char)(batch - sys_dev_ctx->raw_tx_batch + 1)) !=
+		     NRF_WIFI_STATUS_SUCCESS) ||
+		    (tx_enqueue(fmac_dev_ctx,
+				nwb,
+				ac,
+				MAX_PEERS) != NRF_WIFI_STATUS_SUCCESS)) {
+			nrf_wifi_osal_nbuf_free(nwb);
+			batch->num_done++;
+			batch->num_failed++;
+			sys_dev_ctx->raw_pkt_stats.raw_pkt_send_failure++;
+			continue;
+		}
+
+		sys_dev_ctx->raw_pkt_stats.raw_pkt_send_success++;
+		num_queued++;
+	}
+
+	if (!num_queued) {
+		batch->in_use = false;
+		goto unlock;
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	/* Frames are sent once the RPU is back up */
+	if (sys_dev_ctx->recovery.in_progress) {
+		goto unlock;
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+	/* Hand the frames over using all the descriptors available */
+	pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][ac];
+
+	while ((qlen = nrf_wifi_utils_q_len(pend_pkt_q))) {
+		if (!can_xmit(fmac_dev_ctx, nrf_wifi_utils_q_peek(pend_pkt_q))) {
+			break;
+		}
+
+		desc = tx_desc_get(fmac_dev_ctx, ac);
+
+		if (desc == sys_fpriv->num_tx_tokens) {
+			break;
+		}
+
+		if ((tx_pending_process(fmac_dev_ctx,
+					desc,
+					ac) != NRF_WIFI_STATUS_SUCCESS) ||
+		    (nrf_wifi_utils_q_len(pend_pkt_q) >= qlen)) {
+			break;
+		}
+	}
+unlock:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	raw_tx_batch_report(fmac_dev_ctx);
+out:
+	if (nwbs) {
+		for (i = 0; i < num_nwbs; i++) {
+			if (nwbs[i]) {
+				nrf_wifi_osal_nbuf_free(nwbs[i]);
+				nwbs[i] = NULL;
+			}
+		}
+	}
+
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_raw_tx_batch_stats_get(void *dev_ctx,
+							  struct nrf_wifi_fmac_raw_tx_batch_stats *stats,
+							  bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &sys_dev_ctx->raw_tx_batch_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&sys_dev_ctx->raw_tx_batch_stats,
+				      0,
+				      sizeof(sys_dev_ctx->raw_tx_batch_stats));
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_RAW_TX_BATCH */
 #endif /* NRF70_RAW_DATA_TX */
 
 enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *dev_ctx,
@@ -2023,9 +3405,6 @@ enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *dev_ctx,
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	enum nrf_wifi_fmac_tx_status tx_status = NRF_WIFI_FMAC_TX_STATUS_FAIL;
 	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
-	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
-	unsigned char *ra = NULL;
-	int tid = 0;
 	int ac = 0;
 	int peer_id = -1;
 
@@ -2034,30 +3413,21 @@ enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *dev_ctx,
 	}
 
 	fmac_dev_ctx = dev_ctx;
-	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
 	if (nrf_wifi_osal_nbuf_data_size(nbuf) < NRF_WIFI_FMAC_ETH_HDR_LEN) {
 		goto out;
 	}
 
-	ra = nrf_wifi_util_get_ra(sys_dev_ctx->vif_ctx[if_idx], nbuf);
-
-	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, ra);
+	peer_id = tx_classify(fmac_dev_ctx,
+			      if_idx,
+			      nbuf,
+			      &ac);
 
 	if (peer_id == -1) {
 		nrf_wifi_osal_log_err("%s: Got packet for unknown PEER",
 				      __func__);
 
 		goto out;
-	} else if (peer_id == MAX_PEERS) {
-		ac = NRF_WIFI_FMAC_AC_MC;
-	} else {
-		if (sys_dev_ctx->tx_config.peers[peer_id].qos_supported) {
-			tid = nrf_wifi_get_tid(nbuf);
-			ac = get_ac(tid, ra);
-		} else {
-			ac = NRF_WIFI_FMAC_AC_BE;
-		}
 	}
 
 	tx_status = nrf_wifi_fmac_tx(fmac_dev_ctx,
@@ -2079,3 +3449,335 @@ out:
 	}
 	return status;
 }
+
+
+#ifdef NRF70_TX_SEG_OFFLOAD
+#ifndef NRF70_TCP_IP_CHECKSUM_OFFLOAD
+#error "NRF70_TX_SEG_OFFLOAD needs NRF70_TCP_IP_CHECKSUM_OFFLOAD for the segment TCP checksums"
+#endif /* NRF70_TCP_IP_CHECKSUM_OFFLOAD */
+
+/* Returns the length of the Ethernet + IPv4 + TCP headers of a frame, or 0 if
+ * the frame is not a TCP/IPv4 frame that can be segmented.
+ */
+static unsigned int tx_seg_hdr_len(void *nbuf)
+{
+	unsigned char *data = NULL;
+	unsigned char *ip_hdr = NULL;
+	unsigned char *tcp_hdr = NULL;
+	unsigned int len = 0;
+	unsigned int ip_hdr_len = 0;
+	unsigned int tcp_hdr_len = 0;
+
+	data = nrf_wifi_osal_nbuf_data_get(nbuf);
+	len = nrf_wifi_osal_nbuf_data_size(nbuf);
+
+	if ((len < NRF_WIFI_FMAC_ETH_HDR_LEN + NRF_WIFI_FMAC_IPV4_HDR_MIN_LEN) ||
+	    (nrf_wifi_util_tx_get_eth_type(data) != NRF_WIFI_FMAC_ETH_P_IP)) {
+		return 0;
+	}
+
+	ip_hdr = data + NRF_WIFI_FMAC_ETH_HDR_LEN;
+	ip_hdr_len = (ip_hdr[0] & 0x0F) * 4;
+
+	if ((ip_hdr_len < NRF_WIFI_FMAC_IPV4_HDR_MIN_LEN) ||
+	    (ip_hdr[9] != NRF_WIFI_FMAC_IP_PROTO_TCP) ||
+	    /* Fragmented datagrams are left alone */
+	    ((ip_hdr[6] & 0x3F) || ip_hdr[7]) ||
+	    (len < NRF_WIFI_FMAC_ETH_HDR_LEN + ip_hdr_len + NRF_WIFI_FMAC_TCP_HDR_MIN_LEN)) {
+		return 0;
+	}
+
+	tcp_hdr = ip_hdr + ip_hdr_len;
+	tcp_hdr_len = (tcp_hdr[12] >> 4) * 4;
+
+	if ((tcp_hdr_len < NRF_WIFI_FMAC_TCP_HDR_MIN_LEN) ||
+	    (len < NRF_WIFI_FMAC_ETH_HDR_LEN + ip_hdr_len + tcp_hdr_len)) {
+		return 0;
+	}
+
+	return NRF_WIFI_FMAC_ETH_HDR_LEN + ip_hdr_len + tcp_hdr_len;
+}
+
+
+/* Build the segment carrying payload bytes [offset, offset + seg_len) of a
+ * large TCP frame, using the headers of the frame as the template.
+ * The TCP checksum is left for the RPU to fill in.
+ */
+static void *tx_seg_build(void *nbuf,
+			  unsigned int hdr_len,
+			  unsigned int offset,
+			  unsigned int seg_len,
+			  unsigned int seg_idx,
+			  bool last)
+{
+	unsigned char *data = NULL;
+	unsigned char *seg_data = NULL;
+	unsigned char *ip_hdr = NULL;
+	unsigned char *tcp_hdr = NULL;
+	unsigned int ip_hdr_len = 0;
+	unsigned int val = 0;
+	unsigned int i = 0;
+	void *seg = NULL;
+
+	seg = nrf_wifi_osal_nbuf_alloc(hdr_len + seg_len);
+
+	if (!seg) {
+		return NULL;
+	}
+
+	data = nrf_wifi_osal_nbuf_data_get(nbuf);
+	seg_data = nrf_wifi_osal_nbuf_data_put(seg,
+					       hdr_len + seg_len);
+
+	nrf_wifi_osal_mem_cpy(seg_data,
+			      data,
+			      hdr_len);
+
+	nrf_wifi_osal_mem_cpy(seg_data + hdr_len,
+			      data + hdr_len + offset,
+			      seg_len);
+
+	ip_hdr = seg_data + NRF_WIFI_FMAC_ETH_HDR_LEN;
+	ip_hdr_len = (ip_hdr[0] & 0x0F) * 4;
+	tcp_hdr = ip_hdr + ip_hdr_len;
+
+	/* IP total length */
+	val = hdr_len - NRF_WIFI_FMAC_ETH_HDR_LEN + seg_len;
+	ip_hdr[2] = val >> 8;
+	ip_hdr[3] = val & 0xFF;
+
+	/* IP identification */
+	val = ((ip_hdr[4] << 8) | ip_hdr[5]) + seg_idx;
+	ip_hdr[4] = (val >> 8) & 0xFF;
+	ip_hdr[5] = val & 0xFF;
+
+	/* IP header checksum, the header changed for every segment */
+	ip_hdr[10] = 0;
+	ip_hdr[11] = 0;
+	val = 0;
+
+	for (i = 0; i < ip_hdr_len; i += 2) {
+		val += (ip_hdr[i] << 8) | ip_hdr[i + 1];
+	}
+
+	val = (val & 0xFFFF) + (val >> 16);
+	val = (val & 0xFFFF) + (val >> 16);
+	val = ~val & 0xFFFF;
+	ip_hdr[10] = val >> 8;
+	ip_hdr[11] = val & 0xFF;
+
+	/* TCP sequence number */
+	val = ((unsigned int)tcp_hdr[4] << 24) |
+		(tcp_hdr[5] << 16) |
+		(tcp_hdr[6] << 8) |
+		tcp_hdr[7];
+	val += offset;
+	tcp_hdr[4] = val >> 24;
+	tcp_hdr[5] = (val >> 16) & 0xFF;
+	tcp_hdr[6] = (val >> 8) & 0xFF;
+	tcp_hdr[7] = val & 0xFF;
+
+	/* FIN/PSH only on the last segment, CWR only on the first */
+	if (!last) {
+		tcp_hdr[13] &= ~(NRF_WIFI_FMAC_TCP_FLAG_FIN | NRF_WIFI_FMAC_TCP_FLAG_PSH);
+	}
+
+	if (seg_idx) {
+		tcp_hdr[13] &= ~NRF_WIFI_FMAC_TCP_FLAG_CWR;
+	}
+
+	nrf_wifi_osal_nbuf_set_chksum_done(seg,
+					   0);
+
+	return seg;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_start_xmit_seg(void *dev_ctx,
+						  unsigned char if_idx,
+						  void *nbuf,
+						  unsigned short mss)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	void *segs[NRF70_MAX_TX_PENDING_QLEN];
+	void *pend_pkt_q = NULL;
+	unsigned int hdr_len = 0;
+	unsigned int payload_len = 0;
+	unsigned int seg_len = 0;
+	unsigned int num_segs = 0;
+	unsigned int num_queued = 0;
+	unsigned int offset = 0;
+	unsigned int desc = 0;
+	unsigned int qlen = 0;
+	unsigned int i = 0;
+	int ac = 0;
+	int peer_id = -1;
+
+	if (!dev_ctx || !nbuf || !mss) {
+		goto out;
+	}
+
+	fmac_dev_ctx = dev_ctx;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	hdr_len = tx_seg_hdr_len(nbuf);
+
+	if (hdr_len) {
+		payload_len = nrf_wifi_osal_nbuf_data_size(nbuf) - hdr_len;
+	}
+
+	/* Nothing to segment, send it as is */
+	if (!hdr_len || (payload_len <= mss)) {
+		return nrf_wifi_fmac_start_xmit(dev_ctx,
+						if_idx,
+						nbuf);
+	}
+
+	num_segs = (payload_len + mss - 1) / mss;
+
+	/* Each segment takes a slot in the pending queue */
+	if (num_segs > NRF70_MAX_TX_PENDING_QLEN) {
+		nrf_wifi_osal_log_err("%s: Payload of %d bytes needs too many segments",
+				      __func__,
+				      payload_len);
+		goto out;
+	}
+
+	peer_id = tx_classify(fmac_dev_ctx,
+			      if_idx,
+			      nbuf,
+			      &ac);
+
+	if (peer_id == -1) {
+		nrf_wifi_osal_log_err("%s: Got packet for unknown PEER",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_set(segs,
+			      0,
+			      sizeof(segs));
+
+	/* Segment outside the TX lock, only the queueing is done under it */
+	for (i = 0; i < num_segs; i++) {
+		seg_len = payload_len - offset;
+
+		if (seg_len > mss) {
+			seg_len = mss;
+		}
+
+		segs[i] = tx_seg_build(nbuf,
+				       hdr_len,
+				       offset,
+				       seg_len,
+				       i,
+				       (i == num_segs - 1));
+
+		if (!segs[i]) {
+			nrf_wifi_osal_log_err("%s: Unable to allocate segment %d",
+					      __func__,
+					      i);
+			goto free_segs;
+		}
+
+		offset += seg_len;
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	if (sys_fpriv->num_tx_tokens == 0) {
+		goto unlock;
+	}
+
+	pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
+
+	/* Queue either all the segments or none of them, a hole in the
+	 * middle of the stream stalls the TCP sender until it retransmits.
+	 */
+	if ((nrf_wifi_utils_q_len(pend_pkt_q) + num_segs) > NRF70_MAX_TX_PENDING_QLEN) {
+#ifdef NRF70_TX_AQM
+		sys_dev_ctx->tx_config.aqm_stats[peer_id][ac].tail_drops += num_segs;
+#endif /* NRF70_TX_AQM */
+		goto unlock;
+	}
+
+	for (i = 0; i < num_segs; i++) {
+		if (tx_enqueue(fmac_dev_ctx,
+			       segs[i],
+			       ac,
+			       peer_id) != NRF_WIFI_STATUS_SUCCESS) {
+			break;
+		}
+
+		segs[i] = NULL;
+		num_queued++;
+	}
+
+	if (!num_queued) {
+		goto unlock;
+	}
+
+	/* The queued segments are still sent, but a partial send is
+	 * reported as a failure.
+	 */
+	if (num_queued == num_segs) {
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	if (sys_dev_ctx->tx_config.peers[peer_id].ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+		goto unlock;
+	}
+
+#ifdef NRF_WIFI_RPU_FAST_RECOVERY
+	/* Frames are sent once the RPU is back up */
+	if (sys_dev_ctx->recovery.in_progress) {
+		goto unlock;
+	}
+#endif /* NRF_WIFI_RPU_FAST_RECOVERY */
+
+	/* All the segments share the same RA/SA, so fill up as many
+	 * aggregates as there are descriptors available.
+	 */
+	while ((qlen = nrf_wifi_utils_q_len(pend_pkt_q))) {
+		if (!can_xmit(fmac_dev_ctx, nrf_wifi_utils_q_peek(pend_pkt_q))) {
+			break;
+		}
+
+		desc = tx_desc_get(fmac_dev_ctx, ac);
+
+		if (desc == sys_fpriv->num_tx_tokens) {
+			break;
+		}
+
+		if ((tx_pending_process(fmac_dev_ctx,
+					desc,
+					ac) != NRF_WIFI_STATUS_SUCCESS) ||
+		    (nrf_wifi_utils_q_len(pend_pkt_q) >= qlen)) {
+			break;
+		}
+	}
+unlock:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#ifdef NRF70_RAW_TX_BATCH
+
+	raw_tx_batch_report(fmac_dev_ctx);
+#endif /* NRF70_RAW_TX_BATCH */
+free_segs:
+	/* Segments that could not be queued are dropped */
+	for (i = 0; i < num_segs; i++) {
+		if (segs[i]) {
+			nrf_wifi_osal_nbuf_free(segs[i]);
+		}
+	}
+out:
+	if (nbuf) {
+		nrf_wifi_osal_nbuf_free(nbuf);
+	}
+
+	return status;
+}
+#endif /* NRF70_TX_SEG_OFFLOAD */
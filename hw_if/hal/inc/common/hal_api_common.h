@@ -98,15 +98,21 @@ enum NRF_WIFI_HAL_STATUS nrf_wifi_hal_status_unlocked(struct nrf_wifi_hal_dev_ct
  * This function takes care of sending a command to the RPU. It does the
  * following:
  *
- *     - Fragments a command into smaller chunks if the size of a command is
- *       greater than %MAX_CMD_SIZE.
- *     - Queues up the command(s) to the HAL command queue.
+ *     - Queues up the command to the HAL command queue, without copying it.
  *     - Calls a function to further process the commands queued up in the HAL
  *       command queue which handles it by:
  *
  *           - Waiting for the RPU to be ready to handle a command.
  *           - Copies the command to the GRAM memory and indicates to the RPU
- *             that a command has been posted
+ *             that a command has been posted. Commands larger than
+ *             %MAX_CMD_SIZE are copied in successive slices, each to its
+ *             own command buffer.
+ *
+ * The HAL takes ownership of @p cmd and frees it once it has been written.
+ *
+ * With NRF_WIFI_HAL_ASYNC_CMD the command goes through the same queue as
+ * nrf_wifi_hal_ctrl_cmd_send_async, and this function busy-waits, without
+ * sleeping, until it has been posted to the RPU or dropped.
  *
  * @return The status of the operation.
  */
@@ -114,6 +120,48 @@ enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal
 						void *cmd,
 						unsigned int cmd_size);
 
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+/**
+ * @brief Send a control command to the RPU without waiting for a free command buffer.
+ *
+ * @param hal_ctx Pointer to HAL context.
+ * @param cmd Pointer to command data.
+ * @param cmd_size Size of the command data pointed to by @p cmd.
+ * @param callbk_fn Called once the whole command has been
+ *                  posted to the RPU or dropped, may be NULL. It is called
+ *                  with the HAL lock held and must not send commands.
+ * @param callbk_data Data passed to @p callbk_fn.
+ *
+ * This function queues up the command the same way as
+ * nrf_wifi_hal_ctrl_cmd_send and posts as many queued commands as the RPU
+ * has free command buffers for. The remaining ones stay queued and are
+ * posted when the next event is received from the RPU or, failing that,
+ * from a retry timer. A command is dropped if the RPU has no free command
+ * buffer for one of its slices within %MAX_HAL_RPU_READY_WAIT.
+ *
+ * @return The status of queueing the command.
+ */
+enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send_async(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						      void *cmd,
+						      unsigned int cmd_size,
+						      void (*callbk_fn)(void *callbk_data,
+									enum nrf_wifi_status status),
+						      void *callbk_data);
+
+/**
+ * @brief Get the HAL command queue statistics.
+ *
+ * @param hal_ctx Pointer to HAL context.
+ * @param stats Pointer to the statistics to be filled.
+ * @param reset Clear the statistics, except the current depth, after copying them.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_hal_cmd_q_stats_get(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						  struct nrf_wifi_hal_cmd_q_stats *stats,
+						  bool reset);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
 
 /**
  * @brief Process events from the RPU.
@@ -130,6 +178,26 @@ enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal
  */
 enum nrf_wifi_status hal_rpu_eventq_process(struct nrf_wifi_hal_dev_ctx *hal_ctx);
 
+/**
+ * @brief Allocate a HAL message to hold an event read from the RPU.
+ *
+ * @param hal_dev_ctx Pointer to the HAL device context.
+ * @param len         Length of the event data.
+ *
+ * @return Pointer to the HAL message, NULL on failure.
+ */
+struct nrf_wifi_hal_msg *hal_rpu_event_msg_alloc(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						 unsigned int len);
+
+/**
+ * @brief Free a HAL message allocated using hal_rpu_event_msg_alloc().
+ *
+ * @param hal_dev_ctx Pointer to the HAL device context.
+ * @param event       Pointer to the HAL message.
+ */
+void hal_rpu_event_msg_free(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+			    struct nrf_wifi_hal_msg *event);
+
 
 /**
  * @brief Set the processing context for the Wi-Fi HAL.
@@ -194,6 +262,76 @@ enum nrf_wifi_status nrf_wifi_hal_get_rpu_ps_state(struct nrf_wifi_hal_dev_ctx *
 			int *rpu_ps_ctrl_state);
 #endif /* NRF_WIFI_LOW_POWER */
 
+#if defined(NRF_WIFI_RPU_RECOVERY_TELEMETRY) || defined(__DOXYGEN__)
+/**
+ * @brief Report the end of an RPU recovery to the Wi-Fi HAL.
+ *
+ * This function accounts the time since the watchdog interrupt which
+ * triggered the recovery in the recovery telemetry. It is a no-op if no
+ * recovery was triggered by a watchdog interrupt. It is only called at the
+ * end of a fast recovery, a full recovery removes the device along with
+ * its telemetry.
+ *
+ * @param hal_dev_ctx     Pointer to the Wi-Fi HAL device context.
+ */
+void nrf_wifi_hal_rpu_recovery_done(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx);
+
+/**
+ * @brief Get the RPU watchdog and recovery telemetry for the Wi-Fi HAL.
+ *
+ * This function copies the watchdog counters, the last watchdog events and
+ * the recovery durations for the Wi-Fi HAL device context.
+ *
+ * @param hal_dev_ctx     Pointer to the Wi-Fi HAL device context.
+ * @param telemetry       Pointer to the telemetry to be filled.
+ * @param reset           Clear the watchdog events and recovery durations
+ *                        after copying them. The watchdog counters are
+ *                        not cleared.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_hal_rpu_recovery_telemetry_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+							     struct nrf_wifi_hal_rpu_recovery_telemetry *telemetry,
+							     bool reset);
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+#if defined(NRF_WIFI_HAL_EVENT_REASM_BUF) || defined(__DOXYGEN__)
+/**
+ * @brief Get the statistics of the events read from the RPU.
+ *
+ * @param hal_dev_ctx     Pointer to the Wi-Fi HAL device context.
+ * @param stats           Pointer to the statistics to be filled.
+ * @param reset           Clear the statistics after copying them.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_hal_event_stats_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  struct nrf_wifi_hal_event_stats *stats,
+						  bool reset);
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+#if defined(NRF_WIFI_HAL_BUS_SELFTEST) || defined(__DOXYGEN__)
+/**
+ * @brief Measure the bus throughput and latency.
+ *
+ * This function times block and word accesses of several sizes to a scratch
+ * region at the end of the packet RAM and of the global RAM, through the
+ * active bus backend. The scratch regions are saved before the test and
+ * restored after it, but the RPU must not be using them while the test
+ * runs, i.e. the test is meant to be run before the firmware is loaded.
+ *
+ * @param hal_dev_ctx     Pointer to the Wi-Fi HAL device context.
+ * @param num_iters       Number of reads and of writes to time for each
+ *                        access size.
+ * @param result          Pointer to the results to be filled.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_hal_bus_selftest(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					       unsigned int num_iters,
+					       struct nrf_wifi_hal_bus_selftest *result);
+#endif /* NRF_WIFI_HAL_BUS_SELFTEST */
+
 /**
  * @brief Get the OTP information for the Wi-Fi HAL.
  *
@@ -19,4 +19,16 @@ enum nrf_wifi_status hal_rpu_hpq_enqueue(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 enum nrf_wifi_status hal_rpu_hpq_dequeue(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 					 struct host_rpu_hpq *hpq,
 					 unsigned int *val);
+
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+enum nrf_wifi_status hal_rpu_hpq_enqueue_queued(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						struct host_rpu_hpq *hpq,
+						unsigned int val,
+						struct nrf_wifi_bal_xfer_queue *queue);
+
+enum nrf_wifi_status hal_rpu_hpq_dequeue_queued(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						struct host_rpu_hpq *hpq,
+						unsigned int *val,
+						struct nrf_wifi_bal_xfer_queue *queue);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 #endif /* __HAL_COMMON_H__ */
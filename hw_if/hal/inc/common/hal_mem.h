@@ -97,4 +97,63 @@ enum nrf_wifi_status hal_rpu_mem_clr(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 		enum RPU_PROC_TYPE rpu_proc,
 		enum HAL_RPU_MEM_TYPE mem_type);
 
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+/**
+ * @brief Start reading from the RPU RAM.
+ *
+ * This function starts copying a specified number of bytes from the RPU
+ * RAM to the host memory. The host memory must not be accessed until
+ * hal_rpu_mem_xfer_wait() returns.
+ *
+ * @param hal_ctx       Pointer to HAL context.
+ * @param host_addr     Pointer to the host memory where the contents read from
+ *                      the RPU memory are to be copied.
+ * @param rpu_mem_addr  Absolute value of the RPU RAM address from which the
+ *                      contents are to be read.
+ * @param len           The length (in bytes) of the contents to be read.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_mem_read_async(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+		void *host_addr,
+		unsigned int rpu_mem_addr,
+		unsigned int len);
+
+/**
+ * @brief Start writing to the RPU RAM.
+ *
+ * This function starts copying a specified number of bytes from the host
+ * memory to the RPU RAM. The host memory must stay valid until
+ * hal_rpu_mem_xfer_wait() returns.
+ *
+ * @param hal_ctx       Pointer to HAL context.
+ * @param rpu_mem_addr  Absolute value of the RPU RAM address where the
+ *                      contents are to be written.
+ * @param host_addr     Pointer to the host memory from where the contents are
+ *                      to be copied.
+ * @param len           The length (in bytes) of the contents to be written.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_mem_write_async(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+		unsigned int rpu_mem_addr,
+		void *host_addr,
+		unsigned int len);
+
+/**
+ * @brief Wait for the started RPU memory transfers to complete.
+ *
+ * @param hal_ctx   Pointer to HAL context.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_mem_xfer_wait(struct nrf_wifi_hal_dev_ctx *hal_ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
 #endif /* __HAL_MEM_H__ */
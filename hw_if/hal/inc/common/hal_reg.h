@@ -53,4 +53,41 @@ enum nrf_wifi_status hal_rpu_reg_read(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 enum nrf_wifi_status hal_rpu_reg_write(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 		unsigned int rpu_reg_addr,
 		unsigned int val);
+
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+/**
+ * @brief Queue a write to an RPU register.
+ *
+ * @param hal_ctx Pointer to HAL context.
+ * @param queue Pointer to the transfer queue to hold the write.
+ * @param rpu_reg_addr Absolute value of RPU register address to which the
+ *                     value is to be written.
+ * @param val The value which is to be written to the RPU register.
+ *
+ * This function adds a 4 byte register write to a transfer queue. The write
+ * reaches the RPU when the queue is flushed using hal_rpu_reg_write_flush(),
+ * so the queue has to be flushed before any access which depends on it.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_reg_write_queued(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+		struct nrf_wifi_bal_xfer_queue *queue,
+		unsigned int rpu_reg_addr,
+		unsigned int val);
+
+/**
+ * @brief Write all the queued register writes to the RPU.
+ *
+ * @param hal_ctx Pointer to HAL context.
+ * @param queue Pointer to the transfer queue.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_reg_write_flush(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+		struct nrf_wifi_bal_xfer_queue *queue);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 #endif /* __HAL_REG_H__ */
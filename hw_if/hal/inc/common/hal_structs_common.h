@@ -25,6 +25,39 @@
  /** 1 sec */
 #define MAX_HAL_RPU_READY_WAIT (1 * 1000 * 1000)
 
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+/** Interval at which queued commands are retried when the RPU has no free
+ * command buffer and no event has been received in the meantime.
+ */
+#define NRF_WIFI_HAL_CMD_RETRY_MS 1
+/** Interval at which nrf_wifi_hal_ctrl_cmd_send polls for its command to be
+ * posted, it busy-waits since it can be called with spinlocks held.
+ */
+#define NRF_WIFI_HAL_CMD_POLL_US 100
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+#if defined(NRF_WIFI_HAL_EVENT_REASM_BUF) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_HAL_EVENT_REASM_MAX_FRAGS
+/** Number of event fragments the preallocated reassembly buffer holds,
+ * larger events are reassembled in a dynamically allocated buffer.
+ */
+#define NRF_WIFI_HAL_EVENT_REASM_MAX_FRAGS 4
+#endif /* NRF_WIFI_HAL_EVENT_REASM_MAX_FRAGS */
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+#if defined(NRF_WIFI_OSAL_MEM_CACHE) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_HAL_CMD_CACHE_SIZE
+/** Number of HAL command wrappers reserved in the command cache. */
+#define NRF_WIFI_HAL_CMD_CACHE_SIZE 8
+#endif /* NRF_WIFI_HAL_CMD_CACHE_SIZE */
+#ifndef NRF_WIFI_HAL_EVENT_CACHE_SIZE
+/** Number of events of up to RPU_EVENT_COMMON_SIZE_MAX bytes reserved in
+ * the event cache, larger events are allocated from the heap.
+ */
+#define NRF_WIFI_HAL_EVENT_CACHE_SIZE 8
+#endif /* NRF_WIFI_HAL_EVENT_CACHE_SIZE */
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
 #if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
 #define RPU_PS_WAKE_INTERVAL_MS 1
 #define RPU_PS_WAKE_TIMEOUT_S 1
@@ -143,6 +176,144 @@ struct nrf_wifi_hal_buf_map_info {
 	unsigned int buf_len;
 };
 
+#if defined(NRF_WIFI_RPU_RECOVERY_TELEMETRY) || defined(__DOXYGEN__)
+/** Number of watchdog events kept in the RPU recovery telemetry. */
+#define NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE 8
+
+/**
+ * @brief Host state captured when a watchdog interrupt is processed.
+ */
+struct nrf_wifi_hal_wdog_event {
+	/** Time at which the interrupt was processed (ms). */
+	unsigned long tstamp_ms;
+	/** Time since the last RPU sleep opportunity (ms). */
+	unsigned int sleep_opp_diff_ms;
+	/** Number of commands queued in the host and not yet sent to the RPU. */
+	unsigned int pending_cmds;
+	/** Number of TX buffers handed to the RPU and not yet completed. */
+	unsigned int outstanding_tx_bufs;
+	/** RPU power save state (enum RPU_PS_STATE), 0 without NRF_WIFI_LOW_POWER. */
+	unsigned char rpu_ps_state;
+	/** WAKEUP_NOW was asserted by the host. */
+	bool wakeup_now_asserted;
+	/** RPU recovery was triggered for this interrupt. */
+	bool recovery_triggered;
+};
+
+/**
+ * @brief RPU watchdog and recovery telemetry.
+ *
+ * The recovery counters and durations only account fast recoveries, so they
+ * stay zero without NRF_WIFI_RPU_FAST_RECOVERY.
+ */
+struct nrf_wifi_hal_rpu_recovery_telemetry {
+	/** Number of watchdog interrupts received. */
+	unsigned int wdt_irq_received;
+	/** Number of watchdog interrupts ignored. */
+	unsigned int wdt_irq_ignored;
+	/** Number of valid entries in wdog_events. */
+	unsigned int num_wdog_events;
+	/** Last watchdog events, oldest first. */
+	struct nrf_wifi_hal_wdog_event wdog_events[NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE];
+	/** Number of recoveries reported as completed. */
+	unsigned int num_recoveries;
+	/** Time from the watchdog interrupt to the end of the last recovery (ms). */
+	unsigned int last_recovery_time_ms;
+	/** Longest recovery (ms). */
+	unsigned int max_recovery_time_ms;
+	/** Cumulative recovery time (ms). */
+	unsigned long total_recovery_time_ms;
+};
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+/**
+ * @brief Statistics of the HAL command queue.
+ */
+struct nrf_wifi_hal_cmd_q_stats {
+	/** Number of commands currently queued. */
+	unsigned int depth;
+	/** Highest number of commands queued. */
+	unsigned int max_depth;
+	/** Number of commands posted to the RPU. */
+	unsigned int num_posted;
+	/** Number of times posting was deferred for lack of a free command buffer. */
+	unsigned int num_deferred;
+	/** Number of commands dropped after waiting too long or failing to post. */
+	unsigned int num_dropped;
+};
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+#if defined(NRF_WIFI_HAL_EVENT_REASM_BUF) || defined(__DOXYGEN__)
+/**
+ * @brief Statistics of the events read from the RPU.
+ */
+struct nrf_wifi_hal_event_stats {
+	/** Number of events received. */
+	unsigned int num_events;
+	/** Number of events received in more than one fragment. */
+	unsigned int num_frag_events;
+	/** Number of fragments of the fragmented events. */
+	unsigned int num_frags;
+	/** Highest number of fragments of an event. */
+	unsigned int max_frags;
+	/** Cumulative time taken to reassemble the fragmented events (us). */
+	unsigned long total_reasm_time_us;
+	/** Longest time taken to reassemble an event (us). */
+	unsigned int max_reasm_time_us;
+	/** Number of events too large for the preallocated reassembly buffer. */
+	unsigned int num_oversized;
+	/** Number of events dropped for lack of memory. */
+	unsigned int num_dropped;
+};
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+#if defined(NRF_WIFI_HAL_BUS_SELFTEST) || defined(__DOXYGEN__)
+/** Number of access sizes measured by the bus self-test. */
+#define NRF_WIFI_HAL_BUS_SELFTEST_NUM_SIZES 5
+
+/**
+ * @brief RPU memories exercised by the bus self-test.
+ */
+enum nrf_wifi_hal_bus_selftest_mem {
+	/** Packet RAM. */
+	NRF_WIFI_HAL_BUS_SELFTEST_MEM_PKTRAM,
+	/** Global RAM. */
+	NRF_WIFI_HAL_BUS_SELFTEST_MEM_GRAM,
+	/** Number of memories. */
+	NRF_WIFI_HAL_BUS_SELFTEST_MEM_MAX
+};
+
+/**
+ * @brief Bus self-test results for one access size.
+ */
+struct nrf_wifi_hal_bus_selftest_stats {
+	/** Access size in bytes, 4 byte accesses use word reads and writes. */
+	unsigned int size;
+	/** Number of reads and of writes done. */
+	unsigned int num_xfers;
+	/** Read throughput (kB/s). */
+	unsigned int rd_kbytes_per_sec;
+	/** Write throughput (kB/s). */
+	unsigned int wr_kbytes_per_sec;
+	/** Average time taken by a read (ns). */
+	unsigned int rd_lat_ns;
+	/** Average time taken by a write (ns). */
+	unsigned int wr_lat_ns;
+	/** Number of bytes read back which differ from the data written. */
+	unsigned int num_mismatch;
+};
+
+/**
+ * @brief Bus self-test results.
+ */
+struct nrf_wifi_hal_bus_selftest {
+	/** Results per memory and access size. */
+	struct nrf_wifi_hal_bus_selftest_stats
+		stats[NRF_WIFI_HAL_BUS_SELFTEST_MEM_MAX][NRF_WIFI_HAL_BUS_SELFTEST_NUM_SIZES];
+};
+#endif /* NRF_WIFI_HAL_BUS_SELFTEST */
+
 /**
  * @brief Structure to hold configuration parameters for the HAL layer
  * in all modes of operation.
@@ -253,6 +424,14 @@ struct nrf_wifi_hal_dev_ctx {
 	unsigned long addr_rpu_pktram_base_rx_pool[MAX_NUM_OF_RX_QUEUES];
 	/** TX frame offset */
 	unsigned long tx_frame_offset;
+#if defined(NRF_WIFI_RX_ZERO_COPY) || defined(__DOXYGEN__)
+	/** RX buffers are written by the RPU directly in host memory */
+	bool rx_zero_copy;
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+#if defined(NRF_WIFI_BAL_XFER_QUEUE) || defined(__DOXYGEN__)
+	/** Register writes made while processing events */
+	struct nrf_wifi_bal_xfer_queue event_xfer_queue;
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 #if defined(NRF_WIFI_RPU_RECOVERY)  || defined(__DOXYGEN__)
 	/** RPU wake up now asserted flag */
 	bool is_wakeup_now_asserted;
@@ -266,6 +445,24 @@ struct nrf_wifi_hal_dev_ctx {
 	int wdt_irq_received;
 	/** Number of watchdog timer interrupts ignored */
 	int wdt_irq_ignored;
+#if defined(NRF_WIFI_RPU_RECOVERY_TELEMETRY) || defined(__DOXYGEN__)
+	/** Ring of the last watchdog events */
+	struct nrf_wifi_hal_wdog_event wdog_events[NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE];
+	/** Number of watchdog events recorded */
+	unsigned int num_wdog_events;
+	/** Number of TX buffers currently mapped */
+	unsigned int num_tx_bufs_mapped;
+	/** Time of the watchdog interrupt which triggered the ongoing recovery */
+	unsigned long recovery_start_ms;
+	/** Number of recoveries reported as completed */
+	unsigned int num_recoveries;
+	/** Duration of the last recovery */
+	unsigned int last_recovery_time_ms;
+	/** Longest recovery */
+	unsigned int max_recovery_time_ms;
+	/** Cumulative recovery time */
+	unsigned long total_recovery_time_ms;
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
 #endif /* NRF_WIFI_RPU_RECOVERY */
 #if defined(NRF_WIFI_LOW_POWER)  || defined(__DOXYGEN__)
 	/** RPU power state */
@@ -280,6 +477,10 @@ struct nrf_wifi_hal_dev_ctx {
 	bool irq_ctx;
 	/** RPU firmware booted flag */
 	bool rpu_fw_booted;
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+	/** Number of started RPU memory transfers not yet waited for */
+	unsigned int rpu_ps_xfer_pending;
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
 #endif /* NRF_WIFI_LOW_POWER */
 	/** Event data */
 	char *event_data;
@@ -291,12 +492,36 @@ struct nrf_wifi_hal_dev_ctx {
 	unsigned int event_data_pending;
 	/** Event resubmit flag */
 	unsigned int event_resubmit;
+#if defined(NRF_WIFI_HAL_EVENT_REASM_BUF) || defined(__DOXYGEN__)
+	/** Preallocated event reassembly buffer */
+	char *event_reasm_buf;
+	/** Size of the event reassembly buffer */
+	unsigned int event_reasm_buf_size;
+	/** Number of fragments of the event being reassembled */
+	unsigned int event_frags;
+	/** Time at which the first fragment of the event was read */
+	unsigned long event_start_time_us;
+	/** Event statistics */
+	struct nrf_wifi_hal_event_stats event_stats;
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
 	/** HAL status */
 	enum NRF_WIFI_HAL_STATUS hal_status;
 	/** Recovery tasklet */
 	void *recovery_tasklet;
 	/** Recovery lock */
 	void *lock_recovery;
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+	/** Timer retrying the commands queued while the RPU was busy */
+	void *cmd_q_timer;
+	/** Command queue statistics */
+	struct nrf_wifi_hal_cmd_q_stats cmd_q_stats;
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+#if defined(NRF_WIFI_OSAL_MEM_CACHE) || defined(__DOXYGEN__)
+	/** Cache of HAL command wrappers */
+	void *cmd_cache;
+	/** Cache of commonly sized event messages */
+	void *event_cache;
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 };
 
 /**
@@ -305,7 +530,35 @@ struct nrf_wifi_hal_dev_ctx {
 struct nrf_wifi_hal_msg {
 	/** Length of the message */
 	unsigned int len;
+#if defined(NRF_WIFI_OSAL_MEM_CACHE) || defined(__DOXYGEN__)
+	/** The message was allocated from the event cache */
+	bool from_cache;
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 	/** Message data */
 	char data[0];
 };
+
+/**
+ * @brief Structure to hold a control command queued for the RPU.
+ */
+struct nrf_wifi_hal_cmd {
+	/** Command data, owned by the HAL until it has been written to the RPU */
+	void *data;
+	/** Length of the command */
+	unsigned int len;
+	/** Length of the command already written to the RPU */
+	unsigned int offset;
+#if defined(NRF_WIFI_OSAL_MEM_CACHE) || defined(__DOXYGEN__)
+	/** The command was allocated from the command cache */
+	bool from_cache;
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+#if defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
+	/** Time at which the command was queued or its last slice was written (us) */
+	unsigned long queued_time_us;
+	/** Called once the command has been posted to the RPU or dropped */
+	void (*callbk_fn)(void *callbk_data, enum nrf_wifi_status status);
+	/** Data passed to the completion callback */
+	void *callbk_data;
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+};
 #endif /* __HAL_STRUCTS_COMMON_H__ */
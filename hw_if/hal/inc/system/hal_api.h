@@ -94,6 +94,29 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_ctx
 					    unsigned int pool_id,
 					    unsigned int buf_id);
 
+#if defined(NRF70_RAW_RX_BATCH) || defined(__DOXYGEN__)
+/**
+ * @brief Read the start of a received frame before unmapping its buffer.
+ *
+ * This function copies the first bytes of the frame held in a mapped
+ * receive buffer, so that the frame can be inspected without reading
+ * all of it from the RPU.
+ *
+ * @param hal_ctx     Pointer to the Wi-Fi HAL device context.
+ * @param dst         Buffer to copy the data to.
+ * @param len         The length of the data to copy.
+ * @param pool_id     The pool ID of the buffer.
+ * @param buf_id      The buffer ID.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_peek_rx(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						  void *dst,
+						  unsigned int len,
+						  unsigned int pool_id,
+						  unsigned int buf_id);
+#endif /* NRF70_RAW_RX_BATCH */
+
 /**
  * @brief Map a transmit buffer for the Wi-Fi HAL.
  *
@@ -115,6 +138,21 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 					  unsigned int token,
 					  unsigned int buf_indx);
 
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+/**
+ * @brief Wait for the copies of the mapped transmit buffers to complete.
+ *
+ * nrf_wifi_sys_hal_buf_map_tx() only starts copying a buffer to the RPU,
+ * this function has to be called before the frames are handed over to the
+ * RPU or the buffers are freed.
+ *
+ * @param hal_ctx     Pointer to the Wi-Fi HAL device context.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_map_tx_wait(struct nrf_wifi_hal_dev_ctx *hal_ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
 /**
  * @brief Unmap a transmit buffer from the Wi-Fi HAL.
  *
@@ -138,6 +138,15 @@ static void hal_rpu_ps_sleep(unsigned long data)
 	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
 					&flags);
 
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+	/* The RPU has to stay awake until the started transfers complete */
+	if (hal_dev_ctx->rpu_ps_xfer_pending) {
+		nrf_wifi_osal_timer_schedule(hal_dev_ctx->rpu_ps_timer,
+					     NRF70_RPU_PS_IDLE_TIMEOUT_MS);
+		goto out;
+	}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
 	nrf_wifi_bal_rpu_ps_sleep(hal_dev_ctx->bal_dev_ctx);
 #ifdef NRF_WIFI_RPU_RECOVERY
 	hal_dev_ctx->is_wakeup_now_asserted = false;
@@ -150,6 +159,9 @@ static void hal_rpu_ps_sleep(unsigned long data)
 	nrf_wifi_osal_log_info("%s: RPU PS state is ASLEEP",
 			       __func__);
 #endif /* NRF_WIFI_RPU_RECOVERY_PS_STATE_DEBUG */
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+out:
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
 	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
 				       &flags);
 }
@@ -220,6 +232,134 @@ out:
 }
 #endif /* NRF_WIFI_LOW_POWER */
 
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+#ifndef NRF_WIFI_RPU_RECOVERY
+#error "NRF_WIFI_RPU_RECOVERY_TELEMETRY needs NRF_WIFI_RPU_RECOVERY for the watchdog interrupt handling"
+#endif /* NRF_WIFI_RPU_RECOVERY */
+
+void nrf_wifi_hal_rpu_recovery_done(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	unsigned long flags = 0;
+	unsigned int recovery_time_ms = 0;
+
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->lock_rx,
+					&flags);
+
+	if (!hal_dev_ctx->recovery_start_ms) {
+		/* Recovery was not triggered by a watchdog interrupt */
+		goto out;
+	}
+
+	recovery_time_ms = nrf_wifi_osal_time_elapsed_ms(hal_dev_ctx->recovery_start_ms);
+
+	hal_dev_ctx->recovery_start_ms = 0;
+	hal_dev_ctx->num_recoveries++;
+	hal_dev_ctx->last_recovery_time_ms = recovery_time_ms;
+	hal_dev_ctx->total_recovery_time_ms += recovery_time_ms;
+
+	if (recovery_time_ms > hal_dev_ctx->max_recovery_time_ms) {
+		hal_dev_ctx->max_recovery_time_ms = recovery_time_ms;
+	}
+out:
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->lock_rx,
+				       &flags);
+}
+
+
+enum nrf_wifi_status nrf_wifi_hal_rpu_recovery_telemetry_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+							     struct nrf_wifi_hal_rpu_recovery_telemetry *telemetry,
+							     bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned long flags = 0;
+	unsigned int first = 0;
+	unsigned int i = 0;
+
+	if (!hal_dev_ctx || !telemetry) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->lock_rx,
+					&flags);
+
+	telemetry->wdt_irq_received = hal_dev_ctx->wdt_irq_received;
+	telemetry->wdt_irq_ignored = hal_dev_ctx->wdt_irq_ignored;
+
+	if (hal_dev_ctx->num_wdog_events > NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE) {
+		telemetry->num_wdog_events = NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE;
+		first = hal_dev_ctx->num_wdog_events % NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE;
+	} else {
+		telemetry->num_wdog_events = hal_dev_ctx->num_wdog_events;
+		first = 0;
+	}
+
+	for (i = 0; i < telemetry->num_wdog_events; i++) {
+		nrf_wifi_osal_mem_cpy(&telemetry->wdog_events[i],
+				      &hal_dev_ctx->wdog_events[(first + i) %
+							       NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE],
+				      sizeof(telemetry->wdog_events[i]));
+	}
+
+	telemetry->num_recoveries = hal_dev_ctx->num_recoveries;
+	telemetry->last_recovery_time_ms = hal_dev_ctx->last_recovery_time_ms;
+	telemetry->max_recovery_time_ms = hal_dev_ctx->max_recovery_time_ms;
+	telemetry->total_recovery_time_ms = hal_dev_ctx->total_recovery_time_ms;
+
+	if (reset) {
+		hal_dev_ctx->num_wdog_events = 0;
+		hal_dev_ctx->num_recoveries = 0;
+		hal_dev_ctx->last_recovery_time_ms = 0;
+		hal_dev_ctx->max_recovery_time_ms = 0;
+		hal_dev_ctx->total_recovery_time_ms = 0;
+	}
+
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->lock_rx,
+				       &flags);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
+
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+enum nrf_wifi_status nrf_wifi_hal_event_stats_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  struct nrf_wifi_hal_event_stats *stats,
+						  bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned long flags = 0;
+
+	if (!hal_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->lock_rx,
+					&flags);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &hal_dev_ctx->event_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		nrf_wifi_osal_mem_set(&hal_dev_ctx->event_stats,
+				      0,
+				      sizeof(hal_dev_ctx->event_stats));
+	}
+
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->lock_rx,
+				       &flags);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
 
 static bool hal_rpu_hpq_is_empty(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 				 struct host_rpu_hpq *hpq)
@@ -463,123 +603,294 @@ out:
 }
 
 
-static enum nrf_wifi_status hal_rpu_cmd_process_queue(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+static unsigned int hal_rpu_cmd_frag_len(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					 struct nrf_wifi_hal_cmd *cmd)
 {
-	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_hal_msg *cmd = NULL;
+	unsigned int len = cmd->len - cmd->offset;
 
-	while ((cmd = nrf_wifi_utils_ctrl_q_dequeue(hal_dev_ctx->cmd_q))) {
-#ifndef NRF71_ON_IPC
-		status = hal_rpu_ready_wait(hal_dev_ctx,
-					    NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL);
+	if (len > hal_dev_ctx->hpriv->cfg_params.max_cmd_size) {
+		len = hal_dev_ctx->hpriv->cfg_params.max_cmd_size;
+	}
 
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Timeout waiting to get free cmd buff from RPU",
-					      __func__);
-			nrf_wifi_osal_mem_free(cmd);
-			cmd = NULL;
-			continue;
-		}
-#endif /* !NRF71_ON_IPC */
-		status = hal_rpu_msg_write(hal_dev_ctx,
-					   NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL,
-					   cmd->data,
-					   cmd->len);
+	return len;
+}
 
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Writing command to RPU failed",
-					      __func__);
-			nrf_wifi_osal_mem_free(cmd);
-			cmd = NULL;
-			continue;
+
+static struct nrf_wifi_hal_cmd *hal_rpu_cmd_alloc(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	struct nrf_wifi_hal_cmd *cmd = NULL;
+
+	if (hal_dev_ctx->cmd_cache) {
+		cmd = nrf_wifi_osal_mem_cache_alloc(hal_dev_ctx->cmd_cache);
+
+		if (cmd) {
+			nrf_wifi_osal_mem_set(cmd,
+					      0,
+					      sizeof(*cmd));
+			cmd->from_cache = true;
 		}
 
-		/* Free the command data and command */
-		nrf_wifi_osal_mem_free(cmd);
-		cmd = NULL;
+		return cmd;
 	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 
-	return status;
+	return nrf_wifi_osal_mem_zalloc(sizeof(struct nrf_wifi_hal_cmd));
 }
 
 
-static enum nrf_wifi_status hal_rpu_cmd_queue(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
-					      void *cmd,
-					      unsigned int cmd_size)
+static void hal_rpu_cmd_put(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+			    struct nrf_wifi_hal_cmd *cmd)
 {
-	int len = 0;
-	int size = 0;
-	char *data = NULL;
-	struct nrf_wifi_hal_msg *hal_msg = NULL;
-	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	if (cmd->from_cache) {
+		nrf_wifi_osal_mem_cache_free(hal_dev_ctx->cmd_cache,
+					     cmd);
+		return;
+	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 
-	len = cmd_size;
-	data = cmd;
+	nrf_wifi_osal_mem_free(cmd);
+}
 
-	if (len > hal_dev_ctx->hpriv->cfg_params.max_cmd_size) {
-		while (len > 0) {
-			if (len > hal_dev_ctx->hpriv->cfg_params.max_cmd_size) {
-				size = hal_dev_ctx->hpriv->cfg_params.max_cmd_size;
-			} else {
-				size = len;
-			}
 
-			hal_msg = nrf_wifi_osal_mem_zalloc(sizeof(*hal_msg) + size);
+static void hal_rpu_cmd_free(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+			     struct nrf_wifi_hal_cmd *cmd)
+{
+	nrf_wifi_osal_mem_free(cmd->data);
+	hal_rpu_cmd_put(hal_dev_ctx, cmd);
+}
+
+
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+static void hal_rpu_cmd_q_depth_inc(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	hal_dev_ctx->cmd_q_stats.depth++;
+
+	if (hal_dev_ctx->cmd_q_stats.depth > hal_dev_ctx->cmd_q_stats.max_depth) {
+		hal_dev_ctx->cmd_q_stats.max_depth = hal_dev_ctx->cmd_q_stats.depth;
+	}
+}
+
+
+static void hal_rpu_cmd_complete(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+				 struct nrf_wifi_hal_cmd *cmd,
+				 enum nrf_wifi_status status)
+{
+	hal_dev_ctx->cmd_q_stats.depth--;
+
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		hal_dev_ctx->cmd_q_stats.num_posted++;
+	} else {
+		hal_dev_ctx->cmd_q_stats.num_dropped++;
+	}
+
+	if (cmd->callbk_fn) {
+		cmd->callbk_fn(cmd->callbk_data,
+			       status);
+	}
+
+	hal_rpu_cmd_free(hal_dev_ctx, cmd);
+}
+
+
+static enum nrf_wifi_status hal_rpu_cmd_process_queue(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
+	struct nrf_wifi_hal_cmd *cmd = NULL;
+	unsigned int frag_len = 0;
+
+	while ((cmd = nrf_wifi_utils_q_peek(hal_dev_ctx->cmd_q))) {
+		status = NRF_WIFI_STATUS_SUCCESS;
 
-			if (!hal_msg) {
-				nrf_wifi_osal_log_err("%s: Unable to alloc buff for frag HAL cmd",
+		while (cmd->offset < cmd->len) {
+#ifndef NRF71_ON_IPC
+			if (hal_rpu_ready(hal_dev_ctx,
+					  NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL) != NRF_WIFI_STATUS_SUCCESS) {
+				if (nrf_wifi_osal_time_elapsed_us(cmd->queued_time_us) <
+				    MAX_HAL_RPU_READY_WAIT) {
+					/* Leave the command queued, it is retried when the
+					 * next event comes in or when the timer expires.
+					 */
+					hal_dev_ctx->cmd_q_stats.num_deferred++;
+					nrf_wifi_osal_timer_schedule(hal_dev_ctx->cmd_q_timer,
+								     NRF_WIFI_HAL_CMD_RETRY_MS);
+					goto out;
+				}
+
+				nrf_wifi_osal_log_err("%s: Timeout waiting to get free cmd buff from RPU",
 						      __func__);
 				status = NRF_WIFI_STATUS_FAIL;
-				goto out;
+				break;
 			}
+#endif /* !NRF71_ON_IPC */
+			frag_len = hal_rpu_cmd_frag_len(hal_dev_ctx, cmd);
 
-			nrf_wifi_osal_mem_cpy(hal_msg->data,
-					      data,
-					      size);
+			status = hal_rpu_msg_write(hal_dev_ctx,
+						   NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL,
+						   (char *)cmd->data + cmd->offset,
+						   frag_len);
 
-			hal_msg->len = size;
+			if (status != NRF_WIFI_STATUS_SUCCESS) {
+				nrf_wifi_osal_log_err("%s: Writing command to RPU failed",
+						      __func__);
+				break;
+			}
 
-			status = nrf_wifi_utils_ctrl_q_enqueue(hal_dev_ctx->cmd_q,
-							  hal_msg);
+			cmd->offset += frag_len;
+			/* The wait for the RPU is bounded per slice, a large
+			 * command which is making progress is not dropped.
+			 */
+			cmd->queued_time_us = nrf_wifi_osal_time_get_curr_us();
+		}
+
+		nrf_wifi_utils_ctrl_q_dequeue(hal_dev_ctx->cmd_q);
+		hal_rpu_cmd_complete(hal_dev_ctx, cmd, status);
+	}
+out:
+	return status;
+}
+
+
+static void hal_rpu_cmd_q_kick(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	if (!nrf_wifi_utils_q_len(hal_dev_ctx->cmd_q)) {
+		return;
+	}
+
+	nrf_wifi_osal_spinlock_take(hal_dev_ctx->lock_hal);
+	hal_rpu_cmd_process_queue(hal_dev_ctx);
+	nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
+}
+
+
+static void hal_rpu_cmd_q_timer_fn(unsigned long data)
+{
+	hal_rpu_cmd_q_kick((struct nrf_wifi_hal_dev_ctx *)data);
+}
+
+
+/* Completion state of a command sent through nrf_wifi_hal_ctrl_cmd_send */
+struct hal_rpu_cmd_sync {
+	bool done;
+	enum nrf_wifi_status status;
+};
+
+
+static void hal_rpu_cmd_sync_callbk_fn(void *callbk_data,
+				       enum nrf_wifi_status status)
+{
+	struct hal_rpu_cmd_sync *sync = callbk_data;
+
+	sync->status = status;
+	sync->done = true;
+}
+
+
+static void hal_rpu_cmd_q_drain(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	struct nrf_wifi_hal_cmd *cmd = NULL;
+
+	nrf_wifi_osal_spinlock_take(hal_dev_ctx->lock_hal);
+
+	while ((cmd = nrf_wifi_utils_ctrl_q_dequeue(hal_dev_ctx->cmd_q))) {
+		hal_rpu_cmd_complete(hal_dev_ctx, cmd, NRF_WIFI_STATUS_FAIL);
+	}
+
+	nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
+}
+#else
+static enum nrf_wifi_status hal_rpu_cmd_process_queue(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_hal_cmd *cmd = NULL;
+	unsigned int frag_len = 0;
+
+	while ((cmd = nrf_wifi_utils_ctrl_q_dequeue(hal_dev_ctx->cmd_q))) {
+		/* Commands larger than the RPU command buffers are written
+		 * in slices straight from the command data.
+		 */
+		while (cmd->offset < cmd->len) {
+#ifndef NRF71_ON_IPC
+			status = hal_rpu_ready_wait(hal_dev_ctx,
+						    NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL);
 
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
-				nrf_wifi_osal_log_err("%s: Unable to queue frag HAL cmd",
+				nrf_wifi_osal_log_err("%s: Timeout waiting to get free cmd buff from RPU",
 						      __func__);
-				goto out;
+				break;
 			}
+#endif /* !NRF71_ON_IPC */
+			frag_len = hal_rpu_cmd_frag_len(hal_dev_ctx, cmd);
 
-			len -= size;
-			data += size;
-		}
-	} else {
-		hal_msg = nrf_wifi_osal_mem_zalloc(sizeof(*hal_msg) + len);
+			status = hal_rpu_msg_write(hal_dev_ctx,
+						   NRF_WIFI_HAL_MSG_TYPE_CMD_CTRL,
+						   (char *)cmd->data + cmd->offset,
+						   frag_len);
 
-		if (!hal_msg) {
-			nrf_wifi_osal_log_err("%s: Unable to allocate buffer for HAL command",
-					      __func__);
-			status = NRF_WIFI_STATUS_FAIL;
-			goto out;
+			if (status != NRF_WIFI_STATUS_SUCCESS) {
+				nrf_wifi_osal_log_err("%s: Writing command to RPU failed",
+						      __func__);
+				break;
+			}
+
+			cmd->offset += frag_len;
 		}
 
-		nrf_wifi_osal_mem_cpy(hal_msg->data,
-				      cmd,
-				      len);
+		/* Free the command data and command */
+		hal_rpu_cmd_free(hal_dev_ctx, cmd);
+		cmd = NULL;
+	}
 
-		hal_msg->len = len;
+	return status;
+}
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 
-		status = nrf_wifi_utils_ctrl_q_enqueue(hal_dev_ctx->cmd_q,
-						  hal_msg);
 
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Unable to queue fragmented command",
-					      __func__);
-			goto out;
-		}
+static enum nrf_wifi_status hal_rpu_cmd_queue(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					      void *cmd,
+					      unsigned int cmd_size
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+					      , void (*callbk_fn)(void *callbk_data,
+								  enum nrf_wifi_status status),
+					      void *callbk_data
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+					      )
+{
+	struct nrf_wifi_hal_cmd *hal_cmd = NULL;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	/* The command data is not copied, it is owned by the HAL from here
+	 * on and freed once it has been written to the RPU.
+	 */
+	hal_cmd = hal_rpu_cmd_alloc(hal_dev_ctx);
+
+	if (!hal_cmd) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate HAL command",
+				      __func__);
+		goto out;
 	}
 
-	/* Free the original command data */
-	nrf_wifi_osal_mem_free(cmd);
+	hal_cmd->data = cmd;
+	hal_cmd->len = cmd_size;
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	hal_cmd->queued_time_us = nrf_wifi_osal_time_get_curr_us();
+	hal_cmd->callbk_fn = callbk_fn;
+	hal_cmd->callbk_data = callbk_data;
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+	status = nrf_wifi_utils_ctrl_q_enqueue(hal_dev_ctx->cmd_q,
+					       hal_cmd);
 
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Unable to queue HAL command",
+				      __func__);
+		hal_rpu_cmd_put(hal_dev_ctx, hal_cmd);
+		goto out;
+	}
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	hal_rpu_cmd_q_depth_inc(hal_dev_ctx);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 out:
 	return status;
 }
@@ -590,6 +901,9 @@ enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal
 						unsigned int cmd_size)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	struct hal_rpu_cmd_sync sync = {0};
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 
 
 #ifdef CONFIG_NRF_WIFI_CMD_EVENT_LOG
@@ -605,7 +919,12 @@ enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal
 
 	status = hal_rpu_cmd_queue(hal_dev_ctx,
 				   cmd,
-				   cmd_size);
+				   cmd_size
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+				   , hal_rpu_cmd_sync_callbk_fn,
+				   &sync
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+				   );
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: Queueing of command failed",
@@ -614,6 +933,26 @@ enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal
 	}
 
 	status = hal_rpu_cmd_process_queue(hal_dev_ctx);
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+
+	/* Commands queued ahead of this one or a busy RPU can leave it
+	 * deferred. Wait until it has been posted or dropped so that the
+	 * caller gets its real status. Callers can hold spinlocks (e.g. raw
+	 * TX with the TX lock), so busy-wait, each slice is bounded by
+	 * %MAX_HAL_RPU_READY_WAIT.
+	 */
+	while (!sync.done) {
+		nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
+		nrf_wifi_osal_delay_us(NRF_WIFI_HAL_CMD_POLL_US);
+		nrf_wifi_osal_spinlock_take(hal_dev_ctx->lock_hal);
+
+		if (!sync.done) {
+			hal_rpu_cmd_process_queue(hal_dev_ctx);
+		}
+	}
+
+	status = sync.status;
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 
 out:
 	nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
@@ -622,6 +961,110 @@ out:
 }
 
 
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send_async(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						      void *cmd,
+						      unsigned int cmd_size,
+						      void (*callbk_fn)(void *callbk_data,
+									enum nrf_wifi_status status),
+						      void *callbk_data)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	nrf_wifi_osal_spinlock_take(hal_dev_ctx->lock_hal);
+
+	status = hal_rpu_cmd_queue(hal_dev_ctx,
+				   cmd,
+				   cmd_size,
+				   callbk_fn,
+				   callbk_data);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Queueing of command failed",
+				      __func__);
+		goto out;
+	}
+
+	/* Failures to post are reported through the completion callback */
+	hal_rpu_cmd_process_queue(hal_dev_ctx);
+out:
+	nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
+
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_hal_cmd_q_stats_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  struct nrf_wifi_hal_cmd_q_stats *stats,
+						  bool reset)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!hal_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(hal_dev_ctx->lock_hal);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &hal_dev_ctx->cmd_q_stats,
+			      sizeof(*stats));
+
+	if (reset) {
+		hal_dev_ctx->cmd_q_stats.max_depth = hal_dev_ctx->cmd_q_stats.depth;
+		hal_dev_ctx->cmd_q_stats.num_posted = 0;
+		hal_dev_ctx->cmd_q_stats.num_deferred = 0;
+		hal_dev_ctx->cmd_q_stats.num_dropped = 0;
+	}
+
+	nrf_wifi_osal_spinlock_rel(hal_dev_ctx->lock_hal);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+
+
+struct nrf_wifi_hal_msg *hal_rpu_event_msg_alloc(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						 unsigned int len)
+{
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	struct nrf_wifi_hal_msg *event = NULL;
+
+	if (hal_dev_ctx->event_cache && (len <= RPU_EVENT_COMMON_SIZE_MAX)) {
+		event = nrf_wifi_osal_mem_cache_alloc(hal_dev_ctx->event_cache);
+
+		if (event) {
+			event->from_cache = true;
+		}
+
+		return event;
+	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
+	return nrf_wifi_osal_mem_zalloc(sizeof(struct nrf_wifi_hal_msg) + len);
+}
+
+
+void hal_rpu_event_msg_free(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+			    struct nrf_wifi_hal_msg *event)
+{
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	/* Events too large for the cache were allocated from the heap */
+	if (event->from_cache) {
+		nrf_wifi_osal_mem_cache_free(hal_dev_ctx->event_cache,
+					     event);
+		return;
+	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
+	nrf_wifi_osal_mem_free(event);
+}
+
+
 enum nrf_wifi_status hal_rpu_eventq_process(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
@@ -649,11 +1092,17 @@ enum nrf_wifi_status hal_rpu_eventq_process(struct nrf_wifi_hal_dev_ctx *hal_dev
 		}
 
 		/* Free up the local buffer */
-		nrf_wifi_osal_mem_free(event);
+		hal_rpu_event_msg_free(hal_dev_ctx, event);
 		event = NULL;
 	}
 
 out:
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	/* The RPU might have freed up command buffers while handling the
+	 * commands these events respond to.
+	 */
+	hal_rpu_cmd_q_kick(hal_dev_ctx);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 	return status;
 }
 
@@ -676,7 +1125,7 @@ static void hal_rpu_eventq_drain(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 		}
 
 		/* Free up the local buffer */
-		nrf_wifi_osal_mem_free(event);
+		hal_rpu_event_msg_free(hal_dev_ctx, event);
 		event = NULL;
 	}
 
@@ -712,6 +1161,19 @@ void nrf_wifi_hal_dev_rem(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 
 	nrf_wifi_utils_ctrl_q_free(hal_dev_ctx->cmd_q);
 
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	/* The event and command queues have been drained by now */
+	if (hal_dev_ctx->event_cache) {
+		nrf_wifi_osal_mem_cache_destroy(hal_dev_ctx->event_cache);
+		hal_dev_ctx->event_cache = NULL;
+	}
+
+	if (hal_dev_ctx->cmd_cache) {
+		nrf_wifi_osal_mem_cache_destroy(hal_dev_ctx->cmd_cache);
+		hal_dev_ctx->cmd_cache = NULL;
+	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
 #ifdef NRF_WIFI_LOW_POWER
 	hal_rpu_ps_deinit(hal_dev_ctx);
 #endif /* NRF_WIFI_LOW_POWER */
@@ -726,6 +1188,13 @@ void nrf_wifi_hal_dev_rem(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 		hal_dev_ctx->rx_buf_info[i] = NULL;
 	}
 
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+	if (hal_dev_ctx->event_reasm_buf) {
+		nrf_wifi_osal_mem_free(hal_dev_ctx->event_reasm_buf);
+		hal_dev_ctx->event_reasm_buf = NULL;
+	}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
 	hal_dev_ctx->hpriv->num_devs--;
 
 	nrf_wifi_osal_mem_free(hal_dev_ctx);
@@ -776,6 +1245,62 @@ enum nrf_wifi_status nrf_wifi_hal_dev_init(struct nrf_wifi_hal_dev_ctx *hal_dev_
 
 	hal_dev_ctx->rpu_info.tx_cmd_base = RPU_MEM_TX_CMD_BASE;
 #endif /* !NRF71_ON_IPC */
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	hal_dev_ctx->cmd_q_timer = nrf_wifi_osal_timer_alloc();
+
+	if (!hal_dev_ctx->cmd_q_timer) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate command queue timer",
+				      __func__);
+		status = NRF_WIFI_STATUS_FAIL;
+		goto out;
+	}
+
+	nrf_wifi_osal_timer_init(hal_dev_ctx->cmd_q_timer,
+				 hal_rpu_cmd_q_timer_fn,
+				 (unsigned long)hal_dev_ctx);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+	if (!hal_dev_ctx->event_reasm_buf) {
+		hal_dev_ctx->event_reasm_buf_size = NRF_WIFI_HAL_EVENT_REASM_MAX_FRAGS *
+			hal_dev_ctx->hpriv->cfg_params.max_event_size;
+
+		hal_dev_ctx->event_reasm_buf = nrf_wifi_osal_mem_alloc(hal_dev_ctx->event_reasm_buf_size);
+
+		if (!hal_dev_ctx->event_reasm_buf) {
+			nrf_wifi_osal_log_err("%s: Unable to allocate event reassembly buffer",
+					      __func__);
+			hal_dev_ctx->event_reasm_buf_size = 0;
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+	}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+	if (!hal_dev_ctx->cmd_cache) {
+		hal_dev_ctx->cmd_cache = nrf_wifi_osal_mem_cache_create(sizeof(struct nrf_wifi_hal_cmd),
+									NRF_WIFI_HAL_CMD_CACHE_SIZE);
+
+		if (!hal_dev_ctx->cmd_cache) {
+			nrf_wifi_osal_log_err("%s: Unable to create command cache",
+					      __func__);
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+	}
+
+	if (!hal_dev_ctx->event_cache) {
+		hal_dev_ctx->event_cache = nrf_wifi_osal_mem_cache_create(sizeof(struct nrf_wifi_hal_msg) +
+									  RPU_EVENT_COMMON_SIZE_MAX,
+									  NRF_WIFI_HAL_EVENT_CACHE_SIZE);
+
+		if (!hal_dev_ctx->event_cache) {
+			nrf_wifi_osal_log_err("%s: Unable to create event cache",
+					      __func__);
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
+	}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 	nrf_wifi_hal_enable(hal_dev_ctx);
 out:
 	return status;
@@ -800,6 +1325,15 @@ enum nrf_wifi_status nrf_wifi_hal_ipc_msg_handler(void *priv)
 void nrf_wifi_hal_dev_deinit(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 {
 	nrf_wifi_hal_disable(hal_dev_ctx);
+#ifdef NRF_WIFI_HAL_ASYNC_CMD
+	if (hal_dev_ctx->cmd_q_timer) {
+		nrf_wifi_osal_timer_kill(hal_dev_ctx->cmd_q_timer);
+		nrf_wifi_osal_timer_free(hal_dev_ctx->cmd_q_timer);
+		hal_dev_ctx->cmd_q_timer = NULL;
+	}
+
+	hal_rpu_cmd_q_drain(hal_dev_ctx);
+#endif /* NRF_WIFI_HAL_ASYNC_CMD */
 	nrf_wifi_bal_dev_deinit(hal_dev_ctx->bal_dev_ctx);
 	hal_rpu_eventq_drain(hal_dev_ctx);
 }
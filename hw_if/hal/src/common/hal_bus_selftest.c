@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief File containing the bus self-test definitions for the
+ * HAL Layer of the Wi-Fi driver.
+ */
+
+#include "common/pal.h"
+#include "common/hal_common.h"
+#include "common/hal_mem.h"
+
+#ifdef NRF_WIFI_HAL_BUS_SELFTEST
+
+/* Size of the scratch region used at the end of each RPU memory */
+#define HAL_BUS_SELFTEST_SCRATCH_SIZE 2048
+
+static const unsigned int hal_bus_selftest_sizes[NRF_WIFI_HAL_BUS_SELFTEST_NUM_SIZES] = {
+	4, 32, 128, 512, HAL_BUS_SELFTEST_SCRATCH_SIZE
+};
+
+static const unsigned int hal_bus_selftest_mem_end[NRF_WIFI_HAL_BUS_SELFTEST_MEM_MAX] = {
+	RPU_ADDR_PKTRAM_END,
+	RPU_ADDR_GRAM_END
+};
+
+
+static enum nrf_wifi_status hal_bus_selftest_word(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  unsigned long addr_offset,
+						  unsigned int *val,
+						  bool write)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
+#ifdef NRF_WIFI_LOW_POWER
+	unsigned long flags = 0;
+
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
+					&flags);
+
+	status = hal_rpu_ps_wake(hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RPU wake failed",
+				      __func__);
+		goto out;
+	}
+#endif /* NRF_WIFI_LOW_POWER */
+
+	if (write) {
+		nrf_wifi_bal_write_word(hal_dev_ctx->bal_dev_ctx,
+					addr_offset,
+					*val);
+	} else {
+		*val = nrf_wifi_bal_read_word(hal_dev_ctx->bal_dev_ctx,
+					      addr_offset);
+	}
+
+#ifdef NRF_WIFI_LOW_POWER
+out:
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+				       &flags);
+#endif /* NRF_WIFI_LOW_POWER */
+
+	return status;
+}
+
+
+static enum nrf_wifi_status hal_bus_selftest_xfer(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  unsigned int rpu_addr,
+						  unsigned long addr_offset,
+						  unsigned char *buf,
+						  unsigned int size,
+						  bool write)
+{
+	if (size == sizeof(unsigned int)) {
+		return hal_bus_selftest_word(hal_dev_ctx,
+					     addr_offset,
+					     (unsigned int *)buf,
+					     write);
+	}
+
+	if (write) {
+		return hal_rpu_mem_write(hal_dev_ctx,
+					 rpu_addr,
+					 buf,
+					 size);
+	}
+
+	return hal_rpu_mem_read(hal_dev_ctx,
+				buf,
+				rpu_addr,
+				size);
+}
+
+
+static unsigned int hal_bus_selftest_kbps(unsigned int num_xfers,
+					  unsigned int size,
+					  unsigned int time_us)
+{
+	unsigned long long bytes = (unsigned long long)num_xfers * size;
+
+	/* bytes / us is MB/s, scale it to kB/s */
+	return (unsigned int)((bytes * 1000) / time_us);
+}
+
+
+static enum nrf_wifi_status hal_bus_selftest_run(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						 unsigned int rpu_addr,
+						 unsigned int size,
+						 unsigned int num_iters,
+						 unsigned char *wr_buf,
+						 unsigned char *rd_buf,
+						 struct nrf_wifi_hal_bus_selftest_stats *stats)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned long addr_offset = 0;
+	unsigned long start_time_us = 0;
+	unsigned int rd_time_us = 0;
+	unsigned int wr_time_us = 0;
+	unsigned int i = 0;
+
+	status = pal_rpu_addr_offset_get(rpu_addr,
+					 &addr_offset,
+					 hal_dev_ctx->curr_proc);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: pal_rpu_addr_offset_get failed",
+				      __func__);
+		goto out;
+	}
+
+	/* Use a different pattern for each run so that stale data is caught */
+	for (i = 0; i < size; i++) {
+		wr_buf[i] = (unsigned char)(i + size + rpu_addr);
+	}
+
+	stats->size = size;
+	stats->num_xfers = num_iters;
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+	for (i = 0; i < num_iters; i++) {
+		status = hal_bus_selftest_xfer(hal_dev_ctx,
+					       rpu_addr,
+					       addr_offset,
+					       wr_buf,
+					       size,
+					       true);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Write of %d bytes failed",
+					      __func__,
+					      size);
+			goto out;
+		}
+	}
+
+	wr_time_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+	for (i = 0; i < num_iters; i++) {
+		status = hal_bus_selftest_xfer(hal_dev_ctx,
+					       rpu_addr,
+					       addr_offset,
+					       rd_buf,
+					       size,
+					       false);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Read of %d bytes failed",
+					      __func__,
+					      size);
+			goto out;
+		}
+	}
+
+	rd_time_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+	for (i = 0; i < size; i++) {
+		if (rd_buf[i] != wr_buf[i]) {
+			stats->num_mismatch++;
+		}
+	}
+
+	/* A fast (e.g. simulated) bus can finish within the timer resolution */
+	wr_time_us = wr_time_us ? wr_time_us : 1;
+	rd_time_us = rd_time_us ? rd_time_us : 1;
+
+	stats->rd_kbytes_per_sec = hal_bus_selftest_kbps(num_iters,
+							 size,
+							 rd_time_us);
+	stats->wr_kbytes_per_sec = hal_bus_selftest_kbps(num_iters,
+							 size,
+							 wr_time_us);
+	stats->rd_lat_ns = (unsigned int)(((unsigned long long)rd_time_us * 1000) / num_iters);
+	stats->wr_lat_ns = (unsigned int)(((unsigned long long)wr_time_us * 1000) / num_iters);
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_hal_bus_selftest(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					       unsigned int num_iters,
+					       struct nrf_wifi_hal_bus_selftest *result)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_hal_bus_selftest_stats *stats = NULL;
+	unsigned char *save_buf = NULL;
+	unsigned char *wr_buf = NULL;
+	unsigned char *rd_buf = NULL;
+	unsigned int rpu_addr = 0;
+	unsigned int mem = 0;
+	unsigned int i = 0;
+
+	if (!hal_dev_ctx || !num_iters || !result) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_set(result,
+			      0,
+			      sizeof(*result));
+
+	save_buf = nrf_wifi_osal_mem_alloc(HAL_BUS_SELFTEST_SCRATCH_SIZE);
+	wr_buf = nrf_wifi_osal_mem_alloc(HAL_BUS_SELFTEST_SCRATCH_SIZE);
+	rd_buf = nrf_wifi_osal_mem_alloc(HAL_BUS_SELFTEST_SCRATCH_SIZE);
+
+	if (!save_buf || !wr_buf || !rd_buf) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate test buffers",
+				      __func__);
+		goto out;
+	}
+
+	for (mem = 0; mem < NRF_WIFI_HAL_BUS_SELFTEST_MEM_MAX; mem++) {
+		rpu_addr = hal_bus_selftest_mem_end[mem] + 1 - HAL_BUS_SELFTEST_SCRATCH_SIZE;
+
+		status = hal_rpu_mem_read(hal_dev_ctx,
+					  save_buf,
+					  rpu_addr,
+					  HAL_BUS_SELFTEST_SCRATCH_SIZE);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Saving scratch region 0x%X failed",
+					      __func__,
+					      rpu_addr);
+			goto out;
+		}
+
+		for (i = 0; i < NRF_WIFI_HAL_BUS_SELFTEST_NUM_SIZES; i++) {
+			stats = &result->stats[mem][i];
+
+			status = hal_bus_selftest_run(hal_dev_ctx,
+						      rpu_addr,
+						      hal_bus_selftest_sizes[i],
+						      num_iters,
+						      wr_buf,
+						      rd_buf,
+						      stats);
+
+			if (status != NRF_WIFI_STATUS_SUCCESS) {
+				break;
+			}
+
+			nrf_wifi_osal_log_info("%s: mem %d size %d: rd %d kB/s %d ns, wr %d kB/s %d ns, mismatches %d",
+					       __func__,
+					       mem,
+					       stats->size,
+					       stats->rd_kbytes_per_sec,
+					       stats->rd_lat_ns,
+					       stats->wr_kbytes_per_sec,
+					       stats->wr_lat_ns,
+					       stats->num_mismatch);
+		}
+
+		if (hal_rpu_mem_write(hal_dev_ctx,
+				      rpu_addr,
+				      save_buf,
+				      HAL_BUS_SELFTEST_SCRATCH_SIZE) != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Restoring scratch region 0x%X failed",
+					      __func__,
+					      rpu_addr);
+			status = NRF_WIFI_STATUS_FAIL;
+		}
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+out:
+	if (rd_buf) {
+		nrf_wifi_osal_mem_free(rd_buf);
+	}
+
+	if (wr_buf) {
+		nrf_wifi_osal_mem_free(wr_buf);
+	}
+
+	if (save_buf) {
+		nrf_wifi_osal_mem_free(save_buf);
+	}
+
+	return status;
+}
+#endif /* NRF_WIFI_HAL_BUS_SELFTEST */
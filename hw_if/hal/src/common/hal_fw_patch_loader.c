@@ -10,6 +10,8 @@
  */
 
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_FW_LOAD
+
 #include "common/hal_fw_patch_loader.h"
 #include "common/hal_mem.h"
 
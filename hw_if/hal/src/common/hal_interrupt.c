@@ -9,6 +9,8 @@
  * HAL Layer of the Wi-Fi driver.
  */
 
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_EVENT
+
 #include "queue.h"
 #include "common/hal_reg.h"
 #include "common/hal_mem.h"
@@ -208,9 +210,16 @@ static enum nrf_wifi_status hal_rpu_event_free(struct nrf_wifi_hal_dev_ctx *hal_
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+	status = hal_rpu_hpq_enqueue_queued(hal_dev_ctx,
+					    &hal_dev_ctx->rpu_info.hpqm_info.event_avl_queue,
+					    event_addr,
+					    &hal_dev_ctx->event_xfer_queue);
+#else
 	status = hal_rpu_hpq_enqueue(hal_dev_ctx,
 				     &hal_dev_ctx->rpu_info.hpqm_info.event_avl_queue,
 				     event_addr);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: Enqueueing of event failed",
@@ -223,6 +232,73 @@ out:
 }
 
 
+static char *hal_rpu_event_data_alloc(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+				      unsigned int len)
+{
+	char *event_data = NULL;
+
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+	if (len <= hal_dev_ctx->event_reasm_buf_size) {
+		return hal_dev_ctx->event_reasm_buf;
+	}
+
+	hal_dev_ctx->event_stats.num_oversized++;
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+	event_data = nrf_wifi_osal_mem_zalloc(len);
+
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+	if (!event_data) {
+		hal_dev_ctx->event_stats.num_dropped++;
+	}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+	return event_data;
+}
+
+
+static void hal_rpu_event_data_free(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+	if (hal_dev_ctx->event_data != hal_dev_ctx->event_reasm_buf) {
+		nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
+	}
+#else
+	nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+	hal_dev_ctx->event_data = NULL;
+}
+
+
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+static void hal_rpu_event_stats_update(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	struct nrf_wifi_hal_event_stats *stats = &hal_dev_ctx->event_stats;
+	unsigned int reasm_time_us = 0;
+
+	stats->num_events++;
+
+	if (hal_dev_ctx->event_frags < 2) {
+		return;
+	}
+
+	reasm_time_us = nrf_wifi_osal_time_elapsed_us(hal_dev_ctx->event_start_time_us);
+
+	stats->num_frag_events++;
+	stats->num_frags += hal_dev_ctx->event_frags;
+	stats->total_reasm_time_us += reasm_time_us;
+
+	if (hal_dev_ctx->event_frags > stats->max_frags) {
+		stats->max_frags = hal_dev_ctx->event_frags;
+	}
+
+	if (reasm_time_us > stats->max_reasm_time_us) {
+		stats->max_reasm_time_us = reasm_time_us;
+	}
+}
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
+
 static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					      unsigned int event_addr)
 {
@@ -257,8 +333,9 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 
 		rpu_msg_len = rpu_msg_hdr->len;
 
-		/* Allocate space to assemble the entire event */
-		hal_dev_ctx->event_data = nrf_wifi_osal_mem_zalloc(rpu_msg_len);
+		/* Get space to assemble the entire event */
+		hal_dev_ctx->event_data = hal_rpu_event_data_alloc(hal_dev_ctx,
+								   rpu_msg_len);
 
 		if (!hal_dev_ctx->event_data) {
 			nrf_wifi_osal_log_err("%s: Unable to alloc buff for event data",
@@ -271,6 +348,10 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 		hal_dev_ctx->event_data_len = rpu_msg_len;
 		hal_dev_ctx->event_data_pending = rpu_msg_len;
 		hal_dev_ctx->event_resubmit = rpu_msg_hdr->resubmit;
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+		hal_dev_ctx->event_frags = 1;
+		hal_dev_ctx->event_start_time_us = nrf_wifi_osal_time_get_curr_us();
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
 
 		/* Fragmented event */
 		if (rpu_msg_len > hal_dev_ctx->hpriv->cfg_params.max_event_size) {
@@ -283,8 +364,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Reading of first event fragment failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				hal_rpu_event_data_free(hal_dev_ctx);
 				goto out;
 			}
 
@@ -296,8 +376,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					hal_rpu_event_data_free(hal_dev_ctx);
 					goto out;
 				}
 			}
@@ -320,8 +399,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Reading of large event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					hal_rpu_event_data_free(hal_dev_ctx);
 					goto out;
 				}
 			} else {
@@ -338,8 +416,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					hal_rpu_event_data_free(hal_dev_ctx);
 					goto out;
 				}
 			}
@@ -349,6 +426,9 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 
 		}
 	} else {
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+		hal_dev_ctx->event_frags++;
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
 		event_data_size = (hal_dev_ctx->event_data_pending >
 				   hal_dev_ctx->hpriv->cfg_params.max_event_size) ?
 				  hal_dev_ctx->hpriv->cfg_params.max_event_size :
@@ -363,8 +443,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Reading of large event failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				hal_rpu_event_data_free(hal_dev_ctx);
 				goto out;
 			}
 		}
@@ -377,8 +456,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				hal_rpu_event_data_free(hal_dev_ctx);
 				goto out;
 			}
 		}
@@ -391,14 +469,17 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 	 * fragmented event
 	 */
 	if (!hal_dev_ctx->event_data_pending) {
-		event = nrf_wifi_osal_mem_zalloc(sizeof(*event) + hal_dev_ctx->event_data_len);
+		event = hal_rpu_event_msg_alloc(hal_dev_ctx,
+						hal_dev_ctx->event_data_len);
 
 		if (!event) {
 			nrf_wifi_osal_log_err("%s: Unable to alloc HAL msg for event (%d bytes)",
 					      __func__,
 						  hal_dev_ctx->event_data_len);
-			nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-			hal_dev_ctx->event_data = NULL;
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+			hal_dev_ctx->event_stats.num_dropped++;
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+			hal_rpu_event_data_free(hal_dev_ctx);
 			goto out;
 		}
 
@@ -414,16 +495,18 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: Unable to queue event",
 					      __func__);
-			nrf_wifi_osal_mem_free(event);
+			hal_rpu_event_msg_free(hal_dev_ctx, event);
 			event = NULL;
-			nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-			hal_dev_ctx->event_data = NULL;
+			hal_rpu_event_data_free(hal_dev_ctx);
 			goto out;
 		}
 
+#ifdef NRF_WIFI_HAL_EVENT_REASM_BUF
+		hal_rpu_event_stats_update(hal_dev_ctx);
+#endif /* NRF_WIFI_HAL_EVENT_REASM_BUF */
+
 		/* Reset the state variables */
-		nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-		hal_dev_ctx->event_data = NULL;
+		hal_rpu_event_data_free(hal_dev_ctx);
 		hal_dev_ctx->event_data_curr = NULL;
 		hal_dev_ctx->event_data_len = 0;
 		hal_dev_ctx->event_resubmit = 0;
@@ -443,9 +526,19 @@ static unsigned int hal_rpu_event_get_all(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 		event_addr = 0;
 
 		/* First get the event address */
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+		/* The pop and the freeing of the event are queued, and go
+		 * out together before the next dequeue.
+		 */
+		status = hal_rpu_hpq_dequeue_queued(hal_dev_ctx,
+						    &hal_dev_ctx->rpu_info.hpqm_info.event_busy_queue,
+						    &event_addr,
+						    &hal_dev_ctx->event_xfer_queue);
+#else
 		status = hal_rpu_hpq_dequeue(hal_dev_ctx,
 					     &hal_dev_ctx->rpu_info.hpqm_info.event_busy_queue,
 					     &event_addr);
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: Failed to get event addr",
@@ -475,15 +568,20 @@ static unsigned int hal_rpu_event_get_all(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 	}
 
 out:
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+	if (hal_rpu_reg_write_flush(hal_dev_ctx,
+				    &hal_dev_ctx->event_xfer_queue) != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Flushing queued event writes failed",
+				      __func__);
+	}
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
 	return num_events;
 }
 
 #ifdef NRF_WIFI_RPU_RECOVERY
-static inline bool is_rpu_recovery_needed(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+static inline bool is_rpu_recovery_needed(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					  unsigned int rpu_sleep_opp_diff_ms)
 {
-	unsigned int rpu_sleep_opp_diff_ms = nrf_wifi_osal_time_elapsed_ms(
-		hal_dev_ctx->last_rpu_sleep_opp_time_ms);
-
 #ifdef NRF_WIFI_RPU_RECOVERY_DEBUG
 	nrf_wifi_osal_log_info(
 "RPU sleep opp diff: %d ms, last RPU sleep opp time: %lu",
@@ -502,6 +600,35 @@ static inline bool is_rpu_recovery_needed(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 
 	return true;
 }
+
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+static void hal_rpu_wdog_event_record(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+				      unsigned int rpu_sleep_opp_diff_ms,
+				      bool rpu_recovery)
+{
+	struct nrf_wifi_hal_wdog_event *event = NULL;
+
+	event = &hal_dev_ctx->wdog_events[hal_dev_ctx->num_wdog_events %
+					  NRF_WIFI_HAL_WDOG_EVENT_LOG_SIZE];
+	hal_dev_ctx->num_wdog_events++;
+
+	event->tstamp_ms = nrf_wifi_osal_time_get_curr_ms();
+	event->sleep_opp_diff_ms = rpu_sleep_opp_diff_ms;
+	event->pending_cmds = nrf_wifi_utils_q_len(hal_dev_ctx->cmd_q);
+	event->outstanding_tx_bufs = hal_dev_ctx->num_tx_bufs_mapped;
+#ifdef NRF_WIFI_LOW_POWER
+	event->rpu_ps_state = hal_dev_ctx->rpu_ps_state;
+#else
+	event->rpu_ps_state = 0;
+#endif /* NRF_WIFI_LOW_POWER */
+	event->wakeup_now_asserted = hal_dev_ctx->is_wakeup_now_asserted;
+	event->recovery_triggered = rpu_recovery;
+
+	if (rpu_recovery) {
+		hal_dev_ctx->recovery_start_ms = event->tstamp_ms;
+	}
+}
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
 #endif /* NRF_WIFI_RPU_RECOVERY */
 
 static enum nrf_wifi_status hal_rpu_process_wdog(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
@@ -509,6 +636,9 @@ static enum nrf_wifi_status hal_rpu_process_wdog(struct nrf_wifi_hal_dev_ctx *ha
 {
 	enum nrf_wifi_status nrf_wifi_status = NRF_WIFI_STATUS_FAIL;
 	bool rpu_recovery = false;
+#ifdef NRF_WIFI_RPU_RECOVERY
+	unsigned int rpu_sleep_opp_diff_ms = 0;
+#endif /* NRF_WIFI_RPU_RECOVERY */
 
 #ifdef NRF_WIFI_RPU_RECOVERY_DEBUG
 	nrf_wifi_osal_log_info("Processing watchdog interrupt");
@@ -520,7 +650,10 @@ static enum nrf_wifi_status hal_rpu_process_wdog(struct nrf_wifi_hal_dev_ctx *ha
 	/* Check if host has asserted WAKEUP_NOW or if the RPU has been in
 	 * PS_ACTIVE state for more than the timeout period
 	 */
-	if (!is_rpu_recovery_needed(hal_dev_ctx)) {
+	rpu_sleep_opp_diff_ms = nrf_wifi_osal_time_elapsed_ms(
+		hal_dev_ctx->last_rpu_sleep_opp_time_ms);
+
+	if (!is_rpu_recovery_needed(hal_dev_ctx, rpu_sleep_opp_diff_ms)) {
 		hal_dev_ctx->wdt_irq_ignored++;
 #ifdef NRF_WIFI_RPU_RECOVERY_DEBUG
 		nrf_wifi_osal_log_info("Ignore watchdog interrupt, RPU recovery not needed");
@@ -547,6 +680,11 @@ static enum nrf_wifi_status hal_rpu_process_wdog(struct nrf_wifi_hal_dev_ctx *ha
 #endif /* NRF_WIFI_RPU_RECOVERY_DEBUG */
 #endif /* NRF_WIFI_RPU_RECOVERY */
 out:
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+	hal_rpu_wdog_event_record(hal_dev_ctx,
+				  rpu_sleep_opp_diff_ms,
+				  rpu_recovery);
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
 	/* TODO: Ideally this should be done after successful recovery */
 	hal_rpu_irq_wdog_rearm(hal_dev_ctx);
 
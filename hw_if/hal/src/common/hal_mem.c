@@ -76,7 +76,8 @@ static bool hal_rpu_is_mem_writable(enum RPU_PROC_TYPE proc,
 static enum nrf_wifi_status rpu_mem_read_ram(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					     void *src_addr,
 					     unsigned int ram_addr_val,
-					     unsigned int len)
+					     unsigned int len,
+					     bool async)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	unsigned long addr_offset = 0;
@@ -107,12 +108,27 @@ static enum nrf_wifi_status rpu_mem_read_ram(struct nrf_wifi_hal_dev_ctx *hal_de
 	}
 #endif /* NRF_WIFI_LOW_POWER */
 
-	nrf_wifi_bal_read_block(hal_dev_ctx->bal_dev_ctx,
-				src_addr,
-				addr_offset,
-				len);
-
-	status = NRF_WIFI_STATUS_SUCCESS;
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+	if (async) {
+		status = nrf_wifi_bal_read_block_async(hal_dev_ctx->bal_dev_ctx,
+						       src_addr,
+						       addr_offset,
+						       len);
+#ifdef NRF_WIFI_LOW_POWER
+		if (status == NRF_WIFI_STATUS_SUCCESS) {
+			hal_dev_ctx->rpu_ps_xfer_pending++;
+		}
+#endif /* NRF_WIFI_LOW_POWER */
+	} else
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+	{
+		nrf_wifi_bal_read_block(hal_dev_ctx->bal_dev_ctx,
+					src_addr,
+					addr_offset,
+					len);
+
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
 
 #ifdef NRF_WIFI_LOW_POWER
 out:
@@ -127,7 +143,8 @@ out:
 static enum nrf_wifi_status rpu_mem_write_ram(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					      unsigned int ram_addr_val,
 					      void *src_addr,
-					      unsigned int len)
+					      unsigned int len,
+					      bool async)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	unsigned long addr_offset = 0;
@@ -158,12 +175,27 @@ static enum nrf_wifi_status rpu_mem_write_ram(struct nrf_wifi_hal_dev_ctx *hal_d
 	}
 #endif /* NRF_WIFI_LOW_POWER */
 
-	nrf_wifi_bal_write_block(hal_dev_ctx->bal_dev_ctx,
-				 addr_offset,
-				 src_addr,
-				 len);
-
-	status = NRF_WIFI_STATUS_SUCCESS;
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+	if (async) {
+		status = nrf_wifi_bal_write_block_async(hal_dev_ctx->bal_dev_ctx,
+							addr_offset,
+							src_addr,
+							len);
+#ifdef NRF_WIFI_LOW_POWER
+		if (status == NRF_WIFI_STATUS_SUCCESS) {
+			hal_dev_ctx->rpu_ps_xfer_pending++;
+		}
+#endif /* NRF_WIFI_LOW_POWER */
+	} else
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+	{
+		nrf_wifi_bal_write_block(hal_dev_ctx->bal_dev_ctx,
+					 addr_offset,
+					 src_addr,
+					 len);
+
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
 
 #ifdef NRF_WIFI_LOW_POWER
 out:
@@ -338,7 +370,8 @@ enum nrf_wifi_status hal_rpu_mem_read(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 	status = rpu_mem_read_ram(hal_dev_ctx,
 				  src_addr,
 				  rpu_mem_addr_val,
-				  len);
+				  len,
+				  false);
 out:
 	return status;
 }
@@ -380,7 +413,8 @@ enum nrf_wifi_status hal_rpu_mem_write(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 		status = rpu_mem_write_ram(hal_dev_ctx,
 					   rpu_mem_addr_val,
 					   src_addr,
-					   len);
+					   len,
+					   false);
 	} else if (hal_rpu_is_mem_bev(rpu_mem_addr_val)) {
 		status = rpu_mem_write_bev(hal_dev_ctx,
 					   rpu_mem_addr_val,
@@ -453,3 +487,95 @@ enum nrf_wifi_status hal_rpu_mem_clr(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 out:
 	return status;
 }
+
+
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+enum nrf_wifi_status hal_rpu_mem_read_async(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					    void *host_addr,
+					    unsigned int rpu_mem_addr_val,
+					    unsigned int len)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!hal_dev_ctx || !host_addr) {
+		nrf_wifi_osal_log_err("%s: Invalid params",
+				      __func__);
+		goto out;
+	}
+
+	if (!hal_rpu_is_mem_ram(hal_dev_ctx->curr_proc, rpu_mem_addr_val)) {
+		nrf_wifi_osal_log_err("%s: Invalid memory address 0x%X",
+				      __func__,
+				      rpu_mem_addr_val);
+		goto out;
+	}
+
+	status = rpu_mem_read_ram(hal_dev_ctx,
+				  host_addr,
+				  rpu_mem_addr_val,
+				  len,
+				  true);
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status hal_rpu_mem_write_async(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					     unsigned int rpu_mem_addr_val,
+					     void *host_addr,
+					     unsigned int len)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!hal_dev_ctx || !host_addr) {
+		nrf_wifi_osal_log_err("%s: Invalid params",
+				      __func__);
+		goto out;
+	}
+
+	if (!hal_rpu_is_mem_ram(hal_dev_ctx->curr_proc, rpu_mem_addr_val)) {
+		nrf_wifi_osal_log_err("%s: Invalid memory address 0x%X",
+				      __func__,
+				      rpu_mem_addr_val);
+		goto out;
+	}
+
+	status = rpu_mem_write_ram(hal_dev_ctx,
+				   rpu_mem_addr_val,
+				   host_addr,
+				   len,
+				   true);
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status hal_rpu_mem_xfer_wait(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+#ifdef NRF_WIFI_LOW_POWER
+	unsigned long flags = 0;
+#endif /* NRF_WIFI_LOW_POWER */
+
+	status = nrf_wifi_bal_xfer_wait(hal_dev_ctx->bal_dev_ctx);
+
+#ifdef NRF_WIFI_LOW_POWER
+	/* All started transfers are done, let the RPU go back to sleep once
+	 * it has been idle for the usual timeout.
+	 */
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
+					&flags);
+
+	if (hal_dev_ctx->rpu_ps_xfer_pending) {
+		hal_dev_ctx->rpu_ps_xfer_pending = 0;
+		nrf_wifi_osal_timer_schedule(hal_dev_ctx->rpu_ps_timer,
+					     NRF70_RPU_PS_IDLE_TIMEOUT_MS);
+	}
+
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+				       &flags);
+#endif /* NRF_WIFI_LOW_POWER */
+
+	return status;
+}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
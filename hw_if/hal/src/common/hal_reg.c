@@ -155,3 +155,114 @@ out:
 
 	return status;
 }
+
+
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+enum nrf_wifi_status hal_rpu_reg_write_queued(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					      struct nrf_wifi_bal_xfer_queue *queue,
+					      unsigned int rpu_reg_addr,
+					      unsigned int val)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned long addr_offset = 0;
+
+#ifdef NRF_WIFI_LOW_POWER
+	unsigned long flags = 0;
+#endif /* NRF_WIFI_LOW_POWER */
+
+	if (!hal_dev_ctx || !queue) {
+		return status;
+	}
+
+	if (!hal_rpu_is_reg(rpu_reg_addr)) {
+		nrf_wifi_osal_log_err("%s: Invalid params, rpu_reg_addr (0x%X)",
+				      __func__,
+				      rpu_reg_addr);
+		return status;
+	}
+
+	status = pal_rpu_addr_offset_get(rpu_reg_addr,
+					 &addr_offset,
+					 hal_dev_ctx->curr_proc);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: pal_rpu_get_region_offset failed",
+				      __func__);
+		return status;
+	}
+
+#ifdef NRF_WIFI_LOW_POWER
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
+					&flags);
+
+	/* The queue is written out right away if it is full */
+	status = hal_rpu_ps_wake(hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RPU wake failed",
+				      __func__);
+		goto out;
+	}
+#endif /* NRF_WIFI_LOW_POWER */
+
+	nrf_wifi_bal_xfer_queue_write(hal_dev_ctx->bal_dev_ctx,
+				      queue,
+				      addr_offset,
+				      val);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+
+#ifdef NRF_WIFI_LOW_POWER
+out:
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+				       &flags);
+#endif /* NRF_WIFI_LOW_POWER */
+
+	return status;
+}
+
+
+enum nrf_wifi_status hal_rpu_reg_write_flush(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					     struct nrf_wifi_bal_xfer_queue *queue)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+#ifdef NRF_WIFI_LOW_POWER
+	unsigned long flags = 0;
+#endif /* NRF_WIFI_LOW_POWER */
+
+	if (!hal_dev_ctx || !queue) {
+		return status;
+	}
+
+	if (!queue->num_writes) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+#ifdef NRF_WIFI_LOW_POWER
+	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
+					&flags);
+
+	status = hal_rpu_ps_wake(hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: RPU wake failed",
+				      __func__);
+		goto out;
+	}
+#endif /* NRF_WIFI_LOW_POWER */
+
+	nrf_wifi_bal_xfer_queue_flush(hal_dev_ctx->bal_dev_ctx,
+				      queue);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+
+#ifdef NRF_WIFI_LOW_POWER
+out:
+	nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+				       &flags);
+#endif /* NRF_WIFI_LOW_POWER */
+
+	return status;
+}
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
@@ -67,3 +67,77 @@ enum nrf_wifi_status hal_rpu_hpq_dequeue(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 out:
 	return status;
 }
+
+
+#ifdef NRF_WIFI_BAL_XFER_QUEUE
+enum nrf_wifi_status hal_rpu_hpq_enqueue_queued(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						struct host_rpu_hpq *hpq,
+						unsigned int val,
+						struct nrf_wifi_bal_xfer_queue *queue)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	status = hal_rpu_reg_write_queued(hal_ctx,
+					  queue,
+					  hpq->enqueue_addr,
+					  val);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Queueing write to enqueue address failed",
+				      __func__);
+		goto out;
+	}
+
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status hal_rpu_hpq_dequeue_queued(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+						struct host_rpu_hpq *hpq,
+						unsigned int *val,
+						struct nrf_wifi_bal_xfer_queue *queue)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	/* Earlier pops have to land before the head is read again */
+	status = hal_rpu_reg_write_flush(hal_ctx,
+					 queue);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Flushing queued writes failed",
+				      __func__);
+		goto out;
+	}
+
+	status = hal_rpu_reg_read(hal_ctx,
+				  val,
+				  hpq->dequeue_addr);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Dequeue failed, val (0x%X)",
+				      __func__,
+				      *val);
+		goto out;
+	}
+
+	/* Pop the element only if it is valid, the pop goes out with the
+	 * next flush of the queue.
+	 */
+	if (*val) {
+		status = hal_rpu_reg_write_queued(hal_ctx,
+						  queue,
+						  hpq->dequeue_addr,
+						  *val);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Queueing write to dequeue address failed, val (0x%X)",
+					      __func__,
+					      *val);
+			goto out;
+		}
+	}
+out:
+	return status;
+}
+#endif /* NRF_WIFI_BAL_XFER_QUEUE */
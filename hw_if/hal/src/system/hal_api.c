@@ -132,6 +132,29 @@ unsigned long nrf_wifi_sys_hal_buf_map_rx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RX_ZERO_COPY
+	if (hal_dev_ctx->rx_zero_copy) {
+		/* The RPU writes the frame right after the headroom of the host
+		 * buffer, which already holds the same contents as the bounce
+		 * buffer headroom would. Only the part after the headroom is
+		 * mapped, so that the device cannot write past the buffer.
+		 */
+		rx_buf_info->phy_addr = nrf_wifi_bal_dma_map_inline_rx(hal_dev_ctx->bal_dev_ctx,
+								       buf +
+								       hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz,
+								       buf_len -
+								       hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz,
+								       NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+
+		if (!rx_buf_info->phy_addr) {
+			nrf_wifi_osal_log_err("%s: Inline RX DMA map failed",
+					      __func__);
+		}
+
+		goto out;
+	}
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
 	bounce_buf_addr = hal_dev_ctx->addr_rpu_pktram_base_rx_pool[pool_id] +
 		(buf_id * buf_len);
 
@@ -182,6 +205,18 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_dev
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RX_ZERO_COPY
+	if (hal_dev_ctx->rx_zero_copy) {
+		/* The frame is already in the host buffer */
+		nrf_wifi_bal_dma_unmap_inline_rx(hal_dev_ctx->bal_dev_ctx,
+						 rx_buf_info->phy_addr,
+						 rx_buf_info->buf_len -
+						 hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz,
+						 NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+		goto done;
+	}
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
 	unmapped_addr = nrf_wifi_bal_dma_unmap(hal_dev_ctx->bal_dev_ctx,
 					       rx_buf_info->phy_addr,
 					       rx_buf_info->buf_len,
@@ -196,13 +231,30 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_dev
 			goto out;
 		}
 
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+		hal_rpu_mem_read_async(hal_dev_ctx,
+				       (void *)(rx_buf_info->virt_addr +
+						hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz),
+				       (unsigned int)rpu_addr,
+				       data_len);
+
+		if (hal_rpu_mem_xfer_wait(hal_dev_ctx) != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: RX buffer copy failed",
+					      __func__);
+			goto out;
+		}
+#else
 		hal_rpu_mem_read(hal_dev_ctx,
 				 (void *)(rx_buf_info->virt_addr +
 					  hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz),
 				 (unsigned int)rpu_addr,
 				 data_len);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
 	}
 
+#ifdef NRF_WIFI_RX_ZERO_COPY
+done:
+#endif /* NRF_WIFI_RX_ZERO_COPY */
 	virt_addr = rx_buf_info->virt_addr;
 
 	nrf_wifi_osal_mem_set(rx_buf_info,
@@ -213,6 +265,72 @@ out:
 }
 
 
+#ifdef NRF70_RAW_RX_BATCH
+#ifndef NRF70_RAW_DATA_RX
+#error "NRF70_RAW_RX_BATCH needs NRF70_RAW_DATA_RX for the raw RX path it batches"
+#endif /* NRF70_RAW_DATA_RX */
+
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_peek_rx(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						  void *dst,
+						  unsigned int len,
+						  unsigned int pool_id,
+						  unsigned int buf_id)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_hal_buf_map_info *rx_buf_info = NULL;
+	unsigned long bounce_buf_addr = 0;
+	unsigned long rpu_addr = 0;
+
+	rx_buf_info = &hal_dev_ctx->rx_buf_info[pool_id][buf_id];
+
+	if (!rx_buf_info->mapped || (len > rx_buf_info->buf_len)) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+#ifdef NRF_WIFI_RX_ZERO_COPY
+	if (hal_dev_ctx->rx_zero_copy) {
+		if (len > (rx_buf_info->buf_len -
+			   hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz)) {
+			nrf_wifi_osal_log_err("%s: Invalid parameters",
+					      __func__);
+			goto out;
+		}
+
+		/* The buffer is still mapped for the device */
+		nrf_wifi_bal_dma_sync_inline_rx(hal_dev_ctx->bal_dev_ctx,
+						rx_buf_info->phy_addr,
+						len,
+						NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+
+		nrf_wifi_osal_mem_cpy(dst,
+				      (void *)(rx_buf_info->virt_addr +
+					       hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz),
+				      len);
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
+	bounce_buf_addr = hal_dev_ctx->addr_rpu_pktram_base_rx_pool[pool_id] +
+		(buf_id * rx_buf_info->buf_len) +
+		hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz;
+
+	rpu_addr = RPU_MEM_PKT_BASE + (bounce_buf_addr - hal_dev_ctx->addr_rpu_pktram_base);
+
+	hal_rpu_mem_read(hal_dev_ctx,
+			 dst,
+			 (unsigned int)rpu_addr,
+			 len);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_RAW_RX_BATCH */
+
+
 unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					  unsigned long buf,
 					  unsigned int buf_len,
@@ -226,6 +344,7 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 	unsigned long tx_token_base_addr = hal_dev_ctx->addr_rpu_pktram_base_tx +
 		(token * hal_dev_ctx->hpriv->cfg_params.max_ampdu_len_per_token);
 	unsigned long rpu_addr = 0;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 
 	tx_buf_info = &hal_dev_ctx->tx_buf_info[desc_id];
 
@@ -268,10 +387,24 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 	       buf_len,
 	       hal_dev_ctx->tx_frame_offset);
 
-	hal_rpu_mem_write(hal_dev_ctx,
-			  (unsigned int)rpu_addr,
-			  (void *)buf,
-			  buf_len);
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+	/* Completed in nrf_wifi_sys_hal_buf_map_tx_wait() */
+	status = hal_rpu_mem_write_async(hal_dev_ctx,
+					 (unsigned int)rpu_addr,
+					 (void *)buf,
+					 buf_len);
+#else
+	status = hal_rpu_mem_write(hal_dev_ctx,
+				   (unsigned int)rpu_addr,
+				   (void *)buf,
+				   buf_len);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: TX buffer copy failed",
+				      __func__);
+		goto out;
+	}
 
 	addr_to_map = bounce_buf_addr;
 
@@ -286,6 +419,9 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 		goto out;
 	}
 	tx_buf_info->buf_len = buf_len;
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+	hal_dev_ctx->num_tx_bufs_mapped++;
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
 
 out:
 	if (tx_buf_info->phy_addr) {
@@ -296,6 +432,23 @@ out:
 }
 
 
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_map_tx_wait(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	status = hal_rpu_mem_xfer_wait(hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: TX buffer copy failed",
+				      __func__);
+	}
+
+	return status;
+}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+
 unsigned long nrf_wifi_sys_hal_buf_unmap_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					    unsigned int desc_id)
 {
@@ -327,6 +480,9 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_tx(struct nrf_wifi_hal_dev_ctx *hal_dev
 	nrf_wifi_osal_mem_set(tx_buf_info,
 			      0,
 			      sizeof(*tx_buf_info));
+#ifdef NRF_WIFI_RPU_RECOVERY_TELEMETRY
+	hal_dev_ctx->num_tx_bufs_mapped--;
+#endif /* NRF_WIFI_RPU_RECOVERY_TELEMETRY */
 out:
 	return virt_addr;
 }
@@ -564,6 +720,10 @@ struct nrf_wifi_hal_dev_ctx *nrf_wifi_sys_hal_dev_add(struct nrf_wifi_hal_priv *
 				      __func__);
 		goto lock_recovery_free;
 	}
+#ifdef NRF_WIFI_RX_ZERO_COPY
+
+	hal_dev_ctx->rx_zero_copy = nrf_wifi_bal_inline_rx_supported(hal_dev_ctx->bal_dev_ctx);
+#endif /* NRF_WIFI_RX_ZERO_COPY */
 #ifndef NRF71_ON_IPC
 	status = hal_rpu_irq_enable(hal_dev_ctx);
 
@@ -511,6 +511,60 @@ void nrf_wifi_osal_nbuf_free(void *nbuf);
 void nrf_wifi_osal_nbuf_headroom_res(void *nbuf,
 				     unsigned int size);
 
+#if defined(NRF70_RX_BUF_RECYCLE) || defined(__DOXYGEN__)
+/**
+ * @brief Reset a network buffer for reuse.
+ * @param nbuf Pointer to a network buffer.
+ *
+ * Discards the contents of a network buffer(@p nbuf) and restores its data
+ * pointer, data size and headroom to the values they had when the buffer was
+ * allocated, so that it can be reused instead of being freed.
+ *
+ * @return Size in bytes of the data area of the network buffer, as requested
+ *	   at allocation.
+ */
+unsigned int nrf_wifi_osal_nbuf_reset(void *nbuf);
+#endif /* NRF70_RX_BUF_RECYCLE || __DOXYGEN__ */
+
+#if defined(NRF_WIFI_OSAL_NBUF_BULK) || defined(__DOXYGEN__)
+/**
+ * @brief Allocate a batch of network buffers.
+ * @param size Size in bytes of each network buffer to be allocated.
+ * @param nbufs Array to be filled with the allocated network buffers.
+ * @param num Number of network buffers requested.
+ *
+ * Allocates up to @p num network buffers in one call. The allocation stops
+ * at the first failure, so a short count means the OS ran out of buffers.
+ *
+ * @return Number of network buffers allocated, stored from the start of
+ *	   @p nbufs.
+ */
+unsigned int nrf_wifi_osal_nbuf_alloc_bulk(unsigned int size,
+					   void **nbufs,
+					   unsigned int num);
+
+/**
+ * @brief Free a batch of network buffers.
+ * @param nbufs Array of network buffers.
+ * @param num Number of network buffers in @p nbufs.
+ *
+ * Frees network buffers which were allocated by nrf_wifi_osal_nbuf_alloc()
+ * or nrf_wifi_osal_nbuf_alloc_bulk(). All entries must be valid.
+ */
+void nrf_wifi_osal_nbuf_free_bulk(void **nbufs,
+				  unsigned int num);
+
+/**
+ * @brief Reserve headroom space in a batch of network buffers.
+ * @param nbufs Array of network buffers.
+ * @param num Number of network buffers in @p nbufs.
+ * @param size Size in bytes of the headroom to be reserved in each buffer.
+ */
+void nrf_wifi_osal_nbuf_headroom_res_bulk(void **nbufs,
+					  unsigned int num,
+					  unsigned int size);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK || __DOXYGEN__ */
+
 
 
 /**
@@ -621,7 +675,7 @@ unsigned char nrf_wifi_osal_nbuf_get_chksum_done(void *nbuf);
 void nrf_wifi_osal_nbuf_set_chksum_done(void *nbuf,
 					unsigned char chksum_done);
 
-#if defined(CONFIG_NRF70_RAW_DATA_TX) || defined(__DOXYGEN__)
+#if defined(NRF70_RAW_DATA_TX) || defined(__DOXYGEN__)
 /**
  * @brief Set the raw Tx header in a network buffer.
  * @param nbuf Pointer to a network buffer.
@@ -653,7 +707,7 @@ void *nrf_wifi_osal_nbuf_get_raw_tx_hdr(void *nbuf);
  * @return true if the network buffer is a raw Tx buffer, false otherwise.
  */
 bool nrf_wifi_osal_nbuf_is_raw_tx(void *nbuf);
-#endif /* CONFIG_NRF70_RAW_DATA_TX || __DOXYGEN__ */
+#endif /* NRF70_RAW_DATA_TX || __DOXYGEN__ */
 
 /**
  * @brief Allocate a tasklet.
@@ -910,6 +964,53 @@ void nrf_wifi_osal_bus_pcie_dev_dma_unmap(void *os_pcie_dev_ctx,
 void nrf_wifi_osal_bus_pcie_dev_host_map_get(void *os_pcie_dev_ctx,
 					     struct nrf_wifi_osal_host_map *host_map);
 
+#if defined(NRF_WIFI_BAL_ASYNC_XFER) || defined(__DOXYGEN__)
+/**
+ * @brief Start a DMA copy between host memory and a PCIe device.
+ * @param os_pcie_dev_ctx Pointer to a OS specific PCIe device handle.
+ * @param host_addr Pointer to the host buffer.
+ * @param dev_addr Memory mapped address of the device memory.
+ * @param size Size of the transfer in bytes.
+ * @param dir Direction of the transfer.
+ *
+ * The buffers must not be touched until
+ * nrf_wifi_osal_bus_pcie_dev_dma_xfer_wait() returns.
+ *
+ * @return NRF_WIFI_STATUS_SUCCESS if the transfer has been started,
+ *	   NRF_WIFI_STATUS_FAIL if the OS cannot do DMA for the device.
+ */
+enum nrf_wifi_status nrf_wifi_osal_bus_pcie_dev_dma_xfer(void *os_pcie_dev_ctx,
+							 void *host_addr,
+							 void *dev_addr,
+							 size_t size,
+							 enum nrf_wifi_osal_dma_dir dir);
+
+/**
+ * @brief Wait for the DMA copies of a PCIe device to complete.
+ * @param os_pcie_dev_ctx Pointer to a OS specific PCIe device handle.
+ *
+ * @return NRF_WIFI_STATUS_SUCCESS if all the started transfers completed.
+ */
+enum nrf_wifi_status nrf_wifi_osal_bus_pcie_dev_dma_xfer_wait(void *os_pcie_dev_ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER || __DOXYGEN__ */
+
+#if defined(NRF_WIFI_RX_ZERO_COPY) || defined(__DOXYGEN__)
+/**
+ * @brief Sync DMA mapped host memory for access by the CPU.
+ * @param os_pcie_dev_ctx Pointer to a OS specific PCIe device handle.
+ * @param dma_addr DMA mapped physical host memory address.
+ * @param size Size in bytes of the memory to sync.
+ * @param dir DMA direction.
+ *
+ * Makes the data written by the device visible to the CPU while the memory
+ * stays mapped. Does nothing if the OS does not provide the Op.
+ */
+void nrf_wifi_osal_bus_pcie_dev_dma_sync_for_cpu(void *os_pcie_dev_ctx,
+						 void *dma_addr,
+						 size_t size,
+						 enum nrf_wifi_osal_dma_dir dir);
+#endif /* NRF_WIFI_RX_ZERO_COPY || __DOXYGEN__ */
+
 
 
 
@@ -1210,7 +1311,7 @@ void nrf_wifi_osal_spi_cpy_to(void *priv,
 			      size_t count);
 
 
-#if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
+#if defined(NRF_WIFI_LOW_POWER) || defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
 /**
  * @brief Allocate a timer.
  *
@@ -1261,6 +1362,9 @@ void nrf_wifi_osal_timer_schedule(void *timer,
  * @param timer Pointer to a timer instance.
  */
 void nrf_wifi_osal_timer_kill(void *timer);
+#endif /* NRF_WIFI_LOW_POWER || NRF_WIFI_HAL_ASYNC_CMD */
+
+#if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
 
 /**
  * @brief Puts the QSPI interface to sleep.
@@ -1338,6 +1442,188 @@ int nrf_wifi_osal_mem_cmp(const void *addr1,
  */
 unsigned char nrf_wifi_osal_rand8_get(void);
 
+#if defined(NRF_WIFI_OSAL_MEM_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Create a cache of fixed size objects.
+ * @param obj_size Size of each object in bytes.
+ * @param num_objs Number of objects reserved up front.
+ *
+ * Creates a cache from which objects of @p obj_size bytes can be allocated
+ * and freed in constant time without fragmenting the heap. When all
+ * @p num_objs objects are in use further allocations fall back to
+ * @ref nrf_wifi_osal_mem_alloc.
+ *
+ * @return Pointer to the cache on success, NULL on error.
+ */
+void *nrf_wifi_osal_mem_cache_create(size_t obj_size,
+				     unsigned int num_objs);
+
+/**
+ * @brief Destroy a cache of fixed size objects.
+ * @param cache Pointer to the cache.
+ *
+ * All objects must have been returned to the cache before it is destroyed.
+ */
+void nrf_wifi_osal_mem_cache_destroy(void *cache);
+
+/**
+ * @brief Allocate an object from a cache.
+ * @param cache Pointer to the cache.
+ *
+ * The contents of the object are not initialized.
+ *
+ * @return Pointer to the object on success, NULL on error.
+ */
+void *nrf_wifi_osal_mem_cache_alloc(void *cache);
+
+/**
+ * @brief Return an object to a cache.
+ * @param cache Pointer to the cache.
+ * @param obj Pointer to an object allocated using
+ *	      @ref nrf_wifi_osal_mem_cache_alloc or @ref nrf_wifi_osal_mem_alloc.
+ */
+void nrf_wifi_osal_mem_cache_free(void *cache,
+				  void *obj);
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
+#if defined(NRF_WIFI_OSAL_MEM_ACCT) || defined(__DOXYGEN__)
+/**
+ * @brief Allocate memory for control path requests and account it to a tag.
+ * @param size Size of the memory to be allocated in bytes.
+ * @param tag Subsystem the allocation is charged to.
+ *
+ * @return Pointer to start of allocated memory on success, NULL on error.
+ */
+void *nrf_wifi_osal_mem_alloc_tagged(size_t size,
+				     enum nrf_wifi_osal_mem_tag tag);
+
+/**
+ * @brief Allocate zero-initialized memory for control path requests and
+ *	  account it to a tag.
+ * @param size Size of the memory to be allocated in bytes.
+ * @param tag Subsystem the allocation is charged to.
+ *
+ * @return Pointer to start of allocated memory on success, NULL on error.
+ */
+void *nrf_wifi_osal_mem_zalloc_tagged(size_t size,
+				      enum nrf_wifi_osal_mem_tag tag);
+
+/**
+ * @brief Allocate zero-initialized memory for data and account it to a tag.
+ * @param size Size of the memory to be allocated in bytes.
+ * @param tag Subsystem the allocation is charged to.
+ *
+ * Only allocation counts are tracked for data memory, it is returned as
+ *	allocated by the OS so that it keeps the alignment needed for DMA.
+ *
+ * @return Pointer to start of allocated memory on success, NULL on error.
+ */
+void *nrf_wifi_osal_data_mem_zalloc_tagged(size_t size,
+					   enum nrf_wifi_osal_mem_tag tag);
+
+/**
+ * @brief Allocate a network buffer and account it to a tag.
+ * @param size Size in bytes of the network buffer to be allocated.
+ * @param tag Subsystem the allocation is charged to.
+ *
+ * Only allocation counts are tracked for network buffers, their memory
+ *	is owned by the OS networking stack.
+ *
+ * @return Pointer to the allocated network buffer if successful, NULL otherwise.
+ */
+void *nrf_wifi_osal_nbuf_alloc_tagged(unsigned int size,
+				      enum nrf_wifi_osal_mem_tag tag);
+
+#if defined(NRF_WIFI_OSAL_NBUF_BULK) || defined(__DOXYGEN__)
+/**
+ * @brief Allocate a batch of network buffers and account them to a tag.
+ * @param size Size in bytes of each network buffer to be allocated.
+ * @param nbufs Array to be filled with the allocated network buffers.
+ * @param num Number of network buffers requested.
+ * @param tag Subsystem the allocations are charged to.
+ *
+ * @return Number of network buffers allocated.
+ */
+unsigned int nrf_wifi_osal_nbuf_alloc_bulk_tagged(unsigned int size,
+						  void **nbufs,
+						  unsigned int num,
+						  enum nrf_wifi_osal_mem_tag tag);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK || __DOXYGEN__ */
+
+/**
+ * @brief Get a snapshot of the OSAL memory accounting.
+ * @param acct Pointer to memory where the snapshot is to be copied.
+ */
+void nrf_wifi_osal_mem_acct_get(struct nrf_wifi_osal_mem_acct *acct);
+
+/**
+ * @brief Reset the OSAL memory accounting counters.
+ *
+ * Clears the allocation counters and sets the peak values to the
+ *	currently allocated values. Live byte counts are not affected.
+ */
+void nrf_wifi_osal_mem_acct_reset(void);
+
+#ifndef NRF_WIFI_OSAL_MEM_ACCT_NO_WRAP
+#ifndef NRF_WIFI_OSAL_MEM_TAG
+#define NRF_WIFI_OSAL_MEM_TAG NRF_WIFI_OSAL_MEM_TAG_OTHER
+#endif /* NRF_WIFI_OSAL_MEM_TAG */
+
+/* Charge allocations to the tag selected by the calling source file */
+#define nrf_wifi_osal_mem_alloc(size) \
+	nrf_wifi_osal_mem_alloc_tagged(size, NRF_WIFI_OSAL_MEM_TAG)
+#define nrf_wifi_osal_mem_zalloc(size) \
+	nrf_wifi_osal_mem_zalloc_tagged(size, NRF_WIFI_OSAL_MEM_TAG)
+#define nrf_wifi_osal_data_mem_zalloc(size) \
+	nrf_wifi_osal_data_mem_zalloc_tagged(size, NRF_WIFI_OSAL_MEM_TAG)
+#define nrf_wifi_osal_nbuf_alloc(size) \
+	nrf_wifi_osal_nbuf_alloc_tagged(size, NRF_WIFI_OSAL_MEM_TAG)
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+#define nrf_wifi_osal_nbuf_alloc_bulk(size, nbufs, num) \
+	nrf_wifi_osal_nbuf_alloc_bulk_tagged(size, nbufs, num, NRF_WIFI_OSAL_MEM_TAG)
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+#endif /* !NRF_WIFI_OSAL_MEM_ACCT_NO_WRAP */
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
+#if defined(NRF_WIFI_OSAL_STATIC) && !defined(NRF_WIFI_OSAL_STATIC_NO_WRAP)
+/*
+ * Compile time binding of the hot path primitives.
+ *
+ * The port provides osal_static.h on the include path, defining each of the
+ * primitives below as a static inline function named
+ * nrf_wifi_osal_static_<op>() with the same prototype as the OSAL API, e.g.
+ * nrf_wifi_osal_static_spinlock_irq_take(). Callers then reach the OS
+ * directly and the compiler can inline them. All other primitives, and the
+ * out of line definitions in osal.c, keep going through the ops table
+ * registered using nrf_wifi_osal_init(), which the port still has to
+ * provide in full.
+ */
+#include "osal_static.h"
+
+#define nrf_wifi_osal_mem_cpy nrf_wifi_osal_static_mem_cpy
+#define nrf_wifi_osal_mem_set nrf_wifi_osal_static_mem_set
+#define nrf_wifi_osal_spinlock_take nrf_wifi_osal_static_spinlock_take
+#define nrf_wifi_osal_spinlock_rel nrf_wifi_osal_static_spinlock_rel
+#define nrf_wifi_osal_spinlock_irq_take nrf_wifi_osal_static_spinlock_irq_take
+#define nrf_wifi_osal_spinlock_irq_rel nrf_wifi_osal_static_spinlock_irq_rel
+#define nrf_wifi_osal_nbuf_headroom_res nrf_wifi_osal_static_nbuf_headroom_res
+#define nrf_wifi_osal_nbuf_headroom_get nrf_wifi_osal_static_nbuf_headroom_get
+#define nrf_wifi_osal_nbuf_data_size nrf_wifi_osal_static_nbuf_data_size
+#define nrf_wifi_osal_nbuf_data_get nrf_wifi_osal_static_nbuf_data_get
+#define nrf_wifi_osal_nbuf_data_put nrf_wifi_osal_static_nbuf_data_put
+#define nrf_wifi_osal_nbuf_data_push nrf_wifi_osal_static_nbuf_data_push
+#define nrf_wifi_osal_nbuf_data_pull nrf_wifi_osal_static_nbuf_data_pull
+#define nrf_wifi_osal_nbuf_get_priority nrf_wifi_osal_static_nbuf_get_priority
+#define nrf_wifi_osal_qspi_read_reg32 nrf_wifi_osal_static_qspi_read_reg32
+#define nrf_wifi_osal_qspi_write_reg32 nrf_wifi_osal_static_qspi_write_reg32
+#define nrf_wifi_osal_qspi_cpy_from nrf_wifi_osal_static_qspi_cpy_from
+#define nrf_wifi_osal_qspi_cpy_to nrf_wifi_osal_static_qspi_cpy_to
+#define nrf_wifi_osal_spi_read_reg32 nrf_wifi_osal_static_spi_read_reg32
+#define nrf_wifi_osal_spi_write_reg32 nrf_wifi_osal_static_spi_write_reg32
+#define nrf_wifi_osal_spi_cpy_from nrf_wifi_osal_static_spi_cpy_from
+#define nrf_wifi_osal_spi_cpy_to nrf_wifi_osal_static_spi_cpy_to
+#endif /* NRF_WIFI_OSAL_STATIC && !NRF_WIFI_OSAL_STATIC_NO_WRAP */
+
 #ifdef NRF71_ON_IPC
 int nrf_wifi_osal_ipc_send_msg(unsigned int msg_type,
 	void *msg,
@@ -441,6 +441,16 @@ struct nrf_wifi_osal_ops {
 	 */
 	void (*nbuf_free)(void *nbuf);
 
+#if defined(NRF70_RX_BUF_RECYCLE) || defined(__DOXYGEN__)
+	/**
+	 * @brief Reset a network buffer to the state it had after allocation.
+	 *
+	 * @param nbuf A pointer to the network buffer.
+	 * @return The size of the data area of the network buffer.
+	 */
+	unsigned int (*nbuf_reset)(void *nbuf);
+#endif /* NRF70_RX_BUF_RECYCLE || __DOXYGEN__ */
+
 	/**
 	 * @brief Reserve headroom at the beginning of the data area of a network buffer.
 	 *
@@ -741,6 +751,52 @@ struct nrf_wifi_osal_ops {
 	 */
 	void (*bus_pcie_dev_host_map_get)(void *os_pcie_dev_ctx,
 			struct nrf_wifi_osal_host_map *host_map);
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+
+	/**
+	 * @brief Start a DMA copy between host memory and a PCIe device (optional).
+	 *
+	 * Leave the PCIe DMA transfer Ops as NULL if the OS has no DMA engine
+	 * for the device, the PCIe bus then falls back to memory mapped copies.
+	 *
+	 * @param os_pcie_dev_ctx A pointer to the PCIe device.
+	 * @param host_addr A pointer to the host buffer.
+	 * @param dev_addr The memory mapped device address.
+	 * @param size The size of the transfer.
+	 * @param dir The direction of the transfer.
+	 * @return NRF_WIFI_STATUS_SUCCESS if the transfer has been started.
+	 */
+	enum nrf_wifi_status (*bus_pcie_dev_dma_xfer)(void *os_pcie_dev_ctx,
+						      void *host_addr,
+						      void *dev_addr,
+						      size_t size,
+						      enum nrf_wifi_osal_dma_dir dir);
+
+	/**
+	 * @brief Wait for all the started DMA copies of a PCIe device to complete.
+	 *
+	 * @param os_pcie_dev_ctx A pointer to the PCIe device.
+	 * @return NRF_WIFI_STATUS_SUCCESS if all the transfers completed.
+	 */
+	enum nrf_wifi_status (*bus_pcie_dev_dma_xfer_wait)(void *os_pcie_dev_ctx);
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+#ifdef NRF_WIFI_RX_ZERO_COPY
+
+	/**
+	 * @brief Sync a mapped DMA buffer of a PCIe device for CPU access (optional).
+	 *
+	 * Leave as NULL if the host memory is coherent with the device.
+	 *
+	 * @param os_pcie_dev_ctx A pointer to the PCIe device.
+	 * @param dma_addr The DMA address of the buffer.
+	 * @param size The size of the part of the buffer to sync.
+	 * @param dir The direction of the DMA transfer.
+	 */
+	void (*bus_pcie_dev_dma_sync_for_cpu)(void *os_pcie_dev_ctx,
+					      void *dma_addr,
+					      size_t size,
+					      enum nrf_wifi_osal_dma_dir dir);
+#endif /* NRF_WIFI_RX_ZERO_COPY */
 
 	/**
 	 * @brief Initialize the QSPI bus.
@@ -890,7 +946,7 @@ struct nrf_wifi_osal_ops {
 	void (*bus_spi_dev_host_map_get)(void *os_spi_dev_ctx,
 			struct nrf_wifi_osal_host_map *host_map);
 
-	#if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
+	#if defined(NRF_WIFI_LOW_POWER) || defined(NRF_WIFI_HAL_ASYNC_CMD) || defined(__DOXYGEN__)
 	/**
 	 * @brief Allocate a timer.
 	 *
@@ -930,7 +986,9 @@ struct nrf_wifi_osal_ops {
 	 * @param timer A pointer to the timer to terminate.
 	 */
 	void (*timer_kill)(void *timer);
+	#endif /* NRF_WIFI_LOW_POWER || NRF_WIFI_HAL_ASYNC_CMD */
 
+	#if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
 	/**
 	 * @brief Put the QSPI bus to sleep.
 	 *
@@ -983,6 +1041,84 @@ struct nrf_wifi_osal_ops {
 	 * @return A random 8-bit value.
 	 */
 	unsigned char (*rand8_get)(void);
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+
+	/**
+	 * @brief Create a cache of fixed size objects (optional).
+	 *
+	 * Leave the mem_cache Ops as NULL to use the portable OSAL implementation.
+	 * An OS implementation must fall back to the heap when the cache is
+	 * exhausted and mem_cache_free must accept memory allocated using
+	 * mem_alloc as well.
+	 *
+	 * @param obj_size The size of each object in bytes.
+	 * @param num_objs The number of objects to reserve.
+	 * @return A pointer to the cache.
+	 */
+	void *(*mem_cache_create)(size_t obj_size,
+				  unsigned int num_objs);
+
+	/**
+	 * @brief Destroy a cache of fixed size objects.
+	 *
+	 * @param cache A pointer to the cache.
+	 */
+	void (*mem_cache_destroy)(void *cache);
+
+	/**
+	 * @brief Allocate an object from a cache.
+	 *
+	 * @param cache A pointer to the cache.
+	 * @return A pointer to the object.
+	 */
+	void *(*mem_cache_alloc)(void *cache);
+
+	/**
+	 * @brief Return an object to a cache.
+	 *
+	 * @param cache A pointer to the cache.
+	 * @param obj A pointer to the object.
+	 */
+	void (*mem_cache_free)(void *cache,
+			       void *obj);
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+
+	/**
+	 * @brief Allocate a batch of network buffers (optional).
+	 *
+	 * Leave the bulk nbuf Ops as NULL to fall back to the per buffer Ops.
+	 *
+	 * @param size The size of each network buffer.
+	 * @param nbufs An array to be filled with the network buffers.
+	 * @param num The number of network buffers requested.
+	 * @return The number of network buffers allocated, stored from the
+	 *	   start of @p nbufs.
+	 */
+	unsigned int (*nbuf_alloc_bulk)(unsigned int size,
+					void **nbufs,
+					unsigned int num);
+
+	/**
+	 * @brief Free a batch of network buffers (optional).
+	 *
+	 * @param nbufs An array of network buffers.
+	 * @param num The number of network buffers in @p nbufs.
+	 */
+	void (*nbuf_free_bulk)(void **nbufs,
+			       unsigned int num);
+
+	/**
+	 * @brief Reserve headroom in a batch of network buffers (optional).
+	 *
+	 * @param nbufs An array of network buffers.
+	 * @param num The number of network buffers in @p nbufs.
+	 * @param size The size of the headroom to reserve in each buffer.
+	 */
+	void (*nbuf_headroom_res_bulk)(void **nbufs,
+				       unsigned int num,
+				       unsigned int size);
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
 #ifdef NRF71_ON_IPC
 	int (*ipc_send_msg)(unsigned int msg_type, void *msg, unsigned int msg_len);
 #endif /* NRF71_ON_IPC */
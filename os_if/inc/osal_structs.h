@@ -113,4 +113,71 @@ enum nrf_wifi_assert_op_type {
 	NRF_WIFI_ASSERT_GREATER_THAN_EQUAL_TO
 };
 
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+/**
+ * @brief The subsystem tags used for OSAL memory accounting.
+ *
+ * A source file selects the tag charged for its allocations by defining
+ * NRF_WIFI_OSAL_MEM_TAG before it uses the OSAL allocation APIs.
+ */
+enum nrf_wifi_osal_mem_tag {
+	/** Allocations not attributed to any specific subsystem. */
+	NRF_WIFI_OSAL_MEM_TAG_OTHER,
+	/** TX path allocations. */
+	NRF_WIFI_OSAL_MEM_TAG_TX,
+	/** RX path allocations. */
+	NRF_WIFI_OSAL_MEM_TAG_RX,
+	/** Event processing allocations. */
+	NRF_WIFI_OSAL_MEM_TAG_EVENT,
+	/** Command allocations. */
+	NRF_WIFI_OSAL_MEM_TAG_CMD,
+	/** Firmware loading allocations. */
+	NRF_WIFI_OSAL_MEM_TAG_FW_LOAD,
+	/** The number of tags. */
+	NRF_WIFI_OSAL_MEM_TAG_MAX
+};
+
+/**
+ * @brief Memory accounting statistics for a single subsystem tag.
+ */
+struct nrf_wifi_osal_mem_acct_stats {
+	/** Bytes currently allocated, data memory and network buffers excluded. */
+	unsigned int live_bytes;
+	/** Highest value of live_bytes since the last reset. */
+	unsigned int peak_bytes;
+	/** Number of successful memory allocations. */
+	unsigned int num_allocs;
+	/** Number of memory frees. */
+	unsigned int num_frees;
+	/** Number of failed memory allocations. */
+	unsigned int num_fails;
+	/** Number of successful network buffer allocations. */
+	unsigned int num_nbuf_allocs;
+	/** Number of failed network buffer allocations. */
+	unsigned int num_nbuf_fails;
+	/** Number of successful data memory allocations. */
+	unsigned int num_data_allocs;
+	/** Number of failed data memory allocations. */
+	unsigned int num_data_fails;
+};
+
+/**
+ * @brief OSAL memory accounting snapshot.
+ */
+struct nrf_wifi_osal_mem_acct {
+	/** Per subsystem statistics, indexed by &enum nrf_wifi_osal_mem_tag. */
+	struct nrf_wifi_osal_mem_acct_stats tag[NRF_WIFI_OSAL_MEM_TAG_MAX];
+	/** Bytes currently allocated across all tags, as for the per tag value. */
+	unsigned int live_bytes;
+	/** Highest value of live_bytes since the last reset. */
+	unsigned int peak_bytes;
+	/** Number of network buffers freed through the OSAL. */
+	unsigned int num_nbuf_frees;
+	/** Number of data memory buffers freed through the OSAL. */
+	unsigned int num_data_frees;
+	/** Number of frees of memory not allocated through the OSAL. */
+	unsigned int num_bad_frees;
+};
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
 #endif /* __OSAL_STRUCTS_H__ */
@@ -8,23 +8,416 @@
  * @brief Implements OSAL APIs to abstract OS primitives.
  */
 
+/* The OSAL implements the APIs wrapped in osal_api.h */
+#define NRF_WIFI_OSAL_MEM_ACCT_NO_WRAP
+#define NRF_WIFI_OSAL_STATIC_NO_WRAP
+
 #include "osal_api.h"
 #include "osal_ops.h"
 
 const struct nrf_wifi_osal_ops *os_ops;
 
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+#define NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE 16
+#define NRF_WIFI_OSAL_MEM_ACCT_BUCKETS 32
+
+/* Prepended to every accounted allocation and linked in the table of live
+ * allocations, padded to keep the alignment given by the allocator.
+ */
+union nrf_wifi_osal_mem_acct_hdr {
+	struct {
+		union nrf_wifi_osal_mem_acct_hdr *next;
+		unsigned int size;
+		unsigned short tag;
+	} info;
+	unsigned char pad[NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE];
+};
+
+static void *mem_acct_lock;
+static struct nrf_wifi_osal_mem_acct mem_acct;
+/* Live accounted allocations, hashed on the header address */
+static union nrf_wifi_osal_mem_acct_hdr *mem_acct_live[NRF_WIFI_OSAL_MEM_ACCT_BUCKETS];
+
+
+static void mem_acct_lock_take(unsigned long *flags)
+{
+	if (mem_acct_lock) {
+		os_ops->spinlock_irq_take(mem_acct_lock,
+					  flags);
+	}
+}
+
+
+static void mem_acct_lock_rel(unsigned long *flags)
+{
+	if (mem_acct_lock) {
+		os_ops->spinlock_irq_rel(mem_acct_lock,
+					 flags);
+	}
+}
+
+
+static unsigned int mem_acct_bucket(const void *hdr)
+{
+	return ((unsigned long)hdr / NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE) %
+		NRF_WIFI_OSAL_MEM_ACCT_BUCKETS;
+}
+
+
+static void *mem_acct_alloc_done(void *raw,
+				 size_t size,
+				 enum nrf_wifi_osal_mem_tag tag)
+{
+	union nrf_wifi_osal_mem_acct_hdr *hdr = raw;
+	struct nrf_wifi_osal_mem_acct_stats *stats = NULL;
+	unsigned int bucket = 0;
+	unsigned long flags = 0;
+
+	if (tag >= NRF_WIFI_OSAL_MEM_TAG_MAX) {
+		tag = NRF_WIFI_OSAL_MEM_TAG_OTHER;
+	}
+
+	stats = &mem_acct.tag[tag];
+
+	mem_acct_lock_take(&flags);
+
+	if (!hdr) {
+		stats->num_fails++;
+		mem_acct_lock_rel(&flags);
+		return NULL;
+	}
+
+	hdr->info.size = size;
+	hdr->info.tag = tag;
+
+	bucket = mem_acct_bucket(hdr);
+	hdr->info.next = mem_acct_live[bucket];
+	mem_acct_live[bucket] = hdr;
+
+	stats->num_allocs++;
+	stats->live_bytes += size;
+
+	if (stats->live_bytes > stats->peak_bytes) {
+		stats->peak_bytes = stats->live_bytes;
+	}
+
+	mem_acct.live_bytes += size;
+
+	if (mem_acct.live_bytes > mem_acct.peak_bytes) {
+		mem_acct.peak_bytes = mem_acct.live_bytes;
+	}
+
+	mem_acct_lock_rel(&flags);
+
+	return hdr + 1;
+}
+
+
+/* Returns the start of the allocation if buf was handed out by
+ * mem_acct_alloc_done(), NULL otherwise. Only the live allocation table is
+ * looked up, the memory in front of a foreign buf is never read.
+ */
+static void *mem_acct_free_prep(void *buf)
+{
+	union nrf_wifi_osal_mem_acct_hdr *hdr = NULL;
+	union nrf_wifi_osal_mem_acct_hdr **link = NULL;
+	struct nrf_wifi_osal_mem_acct_stats *stats = NULL;
+	unsigned long flags = 0;
+
+	if (!buf) {
+		return NULL;
+	}
+
+	hdr = (union nrf_wifi_osal_mem_acct_hdr *)((unsigned long)buf -
+						   NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE);
+
+	mem_acct_lock_take(&flags);
+
+	for (link = &mem_acct_live[mem_acct_bucket(hdr)]; *link; link = &(*link)->info.next) {
+		if (*link == hdr) {
+			break;
+		}
+	}
+
+	if (!*link) {
+		mem_acct.num_bad_frees++;
+		mem_acct_lock_rel(&flags);
+		return NULL;
+	}
+
+	*link = hdr->info.next;
+
+	stats = &mem_acct.tag[hdr->info.tag];
+	stats->num_frees++;
+	stats->live_bytes -= hdr->info.size;
+	mem_acct.live_bytes -= hdr->info.size;
+
+	mem_acct_lock_rel(&flags);
+
+	return hdr;
+}
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+#define NRF_WIFI_OSAL_MEM_CACHE_ALIGN 8
+
+struct nrf_wifi_osal_mem_cache {
+	void *lock;
+	unsigned char *objs_start;
+	unsigned char *objs_end;
+	void *free_list;
+	size_t obj_size;
+};
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+static unsigned int nbuf_alloc_bulk(unsigned int size,
+				    void **nbufs,
+				    unsigned int num)
+{
+	unsigned int i = 0;
+
+	if (!nbufs || !num) {
+		return 0;
+	}
+
+	if (os_ops->nbuf_alloc_bulk) {
+		return os_ops->nbuf_alloc_bulk(size,
+					       nbufs,
+					       num);
+	}
+
+	for (i = 0; i < num; i++) {
+		nbufs[i] = os_ops->nbuf_alloc(size);
+
+		if (!nbufs[i]) {
+			break;
+		}
+	}
+
+	return i;
+}
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
 void nrf_wifi_osal_init(const struct nrf_wifi_osal_ops *ops)
 {
 	os_ops = ops;
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	mem_acct_lock = os_ops->spinlock_alloc();
+
+	if (mem_acct_lock) {
+		os_ops->spinlock_init(mem_acct_lock);
+	}
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
 }
 
 
 void nrf_wifi_osal_deinit(void)
 {
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	if (mem_acct_lock) {
+		os_ops->spinlock_free(mem_acct_lock);
+		mem_acct_lock = NULL;
+	}
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
 	os_ops = NULL;
 }
 
 
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+void *nrf_wifi_osal_mem_alloc_tagged(size_t size,
+				     enum nrf_wifi_osal_mem_tag tag)
+{
+	return mem_acct_alloc_done(os_ops->mem_alloc(size + NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE),
+				   size,
+				   tag);
+}
+
+
+void *nrf_wifi_osal_mem_zalloc_tagged(size_t size,
+				      enum nrf_wifi_osal_mem_tag tag)
+{
+	return mem_acct_alloc_done(os_ops->mem_zalloc(size + NRF_WIFI_OSAL_MEM_ACCT_HDR_SIZE),
+				   size,
+				   tag);
+}
+
+
+/* Data memory is not wrapped, so that it keeps the alignment the port
+ * gives to DMA buffers, only the allocations are counted.
+ */
+void *nrf_wifi_osal_data_mem_zalloc_tagged(size_t size,
+					   enum nrf_wifi_osal_mem_tag tag)
+{
+	void *buf = NULL;
+	unsigned long flags = 0;
+
+	if (tag >= NRF_WIFI_OSAL_MEM_TAG_MAX) {
+		tag = NRF_WIFI_OSAL_MEM_TAG_OTHER;
+	}
+
+	buf = os_ops->data_mem_zalloc(size);
+
+	mem_acct_lock_take(&flags);
+
+	if (buf) {
+		mem_acct.tag[tag].num_data_allocs++;
+	} else {
+		mem_acct.tag[tag].num_data_fails++;
+	}
+
+	mem_acct_lock_rel(&flags);
+
+	return buf;
+}
+
+
+void *nrf_wifi_osal_nbuf_alloc_tagged(unsigned int size,
+				      enum nrf_wifi_osal_mem_tag tag)
+{
+	void *nbuf = NULL;
+	unsigned long flags = 0;
+
+	if (tag >= NRF_WIFI_OSAL_MEM_TAG_MAX) {
+		tag = NRF_WIFI_OSAL_MEM_TAG_OTHER;
+	}
+
+	nbuf = os_ops->nbuf_alloc(size);
+
+	mem_acct_lock_take(&flags);
+
+	if (nbuf) {
+		mem_acct.tag[tag].num_nbuf_allocs++;
+	} else {
+		mem_acct.tag[tag].num_nbuf_fails++;
+	}
+
+	mem_acct_lock_rel(&flags);
+
+	return nbuf;
+}
+
+
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+unsigned int nrf_wifi_osal_nbuf_alloc_bulk_tagged(unsigned int size,
+						  void **nbufs,
+						  unsigned int num,
+						  enum nrf_wifi_osal_mem_tag tag)
+{
+	unsigned int num_allocd = 0;
+	unsigned long flags = 0;
+
+	if (tag >= NRF_WIFI_OSAL_MEM_TAG_MAX) {
+		tag = NRF_WIFI_OSAL_MEM_TAG_OTHER;
+	}
+
+	num_allocd = nbuf_alloc_bulk(size,
+				     nbufs,
+				     num);
+
+	mem_acct_lock_take(&flags);
+
+	mem_acct.tag[tag].num_nbuf_allocs += num_allocd;
+
+	if (num_allocd < num) {
+		mem_acct.tag[tag].num_nbuf_fails++;
+	}
+
+	mem_acct_lock_rel(&flags);
+
+	return num_allocd;
+}
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+
+void nrf_wifi_osal_mem_acct_get(struct nrf_wifi_osal_mem_acct *acct)
+{
+	unsigned long flags = 0;
+
+	if (!acct) {
+		return;
+	}
+
+	mem_acct_lock_take(&flags);
+	os_ops->mem_cpy(acct,
+			&mem_acct,
+			sizeof(*acct));
+	mem_acct_lock_rel(&flags);
+}
+
+
+void nrf_wifi_osal_mem_acct_reset(void)
+{
+	struct nrf_wifi_osal_mem_acct_stats *stats = NULL;
+	unsigned long flags = 0;
+	int i = 0;
+
+	mem_acct_lock_take(&flags);
+
+	for (i = 0; i < NRF_WIFI_OSAL_MEM_TAG_MAX; i++) {
+		stats = &mem_acct.tag[i];
+
+		stats->peak_bytes = stats->live_bytes;
+		stats->num_allocs = 0;
+		stats->num_frees = 0;
+		stats->num_fails = 0;
+		stats->num_nbuf_allocs = 0;
+		stats->num_nbuf_fails = 0;
+		stats->num_data_allocs = 0;
+		stats->num_data_fails = 0;
+	}
+
+	mem_acct.peak_bytes = mem_acct.live_bytes;
+	mem_acct.num_nbuf_frees = 0;
+	mem_acct.num_data_frees = 0;
+	mem_acct.num_bad_frees = 0;
+
+	mem_acct_lock_rel(&flags);
+}
+
+
+void *nrf_wifi_osal_mem_alloc(size_t size)
+{
+	return nrf_wifi_osal_mem_alloc_tagged(size,
+					      NRF_WIFI_OSAL_MEM_TAG_OTHER);
+}
+
+
+void *nrf_wifi_osal_mem_zalloc(size_t size)
+{
+	return nrf_wifi_osal_mem_zalloc_tagged(size,
+					       NRF_WIFI_OSAL_MEM_TAG_OTHER);
+}
+
+
+void *nrf_wifi_osal_data_mem_zalloc(size_t size)
+{
+	return nrf_wifi_osal_data_mem_zalloc_tagged(size,
+						    NRF_WIFI_OSAL_MEM_TAG_OTHER);
+}
+
+
+void nrf_wifi_osal_mem_free(void *buf)
+{
+	void *raw = mem_acct_free_prep(buf);
+
+	os_ops->mem_free(raw ? raw : buf);
+}
+
+
+void nrf_wifi_osal_data_mem_free(void *buf)
+{
+	unsigned long flags = 0;
+
+	if (buf) {
+		mem_acct_lock_take(&flags);
+		mem_acct.num_data_frees++;
+		mem_acct_lock_rel(&flags);
+	}
+
+	os_ops->data_mem_free(buf);
+}
+#else
 void *nrf_wifi_osal_mem_alloc(size_t size)
 {
 	return os_ops->mem_alloc(size);
@@ -53,6 +446,147 @@ void nrf_wifi_osal_data_mem_free(void *buf)
 {
 	os_ops->data_mem_free(buf);
 }
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
+
+#ifdef NRF_WIFI_OSAL_MEM_CACHE
+void *nrf_wifi_osal_mem_cache_create(size_t obj_size,
+				     unsigned int num_objs)
+{
+	struct nrf_wifi_osal_mem_cache *cache = NULL;
+	unsigned char *obj = NULL;
+	unsigned int i = 0;
+
+	if (os_ops->mem_cache_create) {
+		return os_ops->mem_cache_create(obj_size,
+						num_objs);
+	}
+
+	if (!obj_size || !num_objs) {
+		return NULL;
+	}
+
+	/* Free objects hold the link to the next free object */
+	if (obj_size < sizeof(void *)) {
+		obj_size = sizeof(void *);
+	}
+
+	obj_size = (obj_size + NRF_WIFI_OSAL_MEM_CACHE_ALIGN - 1) &
+		~(NRF_WIFI_OSAL_MEM_CACHE_ALIGN - 1);
+
+	cache = nrf_wifi_osal_mem_zalloc(sizeof(*cache) +
+					 NRF_WIFI_OSAL_MEM_CACHE_ALIGN +
+					 (obj_size * num_objs));
+
+	if (!cache) {
+		return NULL;
+	}
+
+	cache->lock = os_ops->spinlock_alloc();
+
+	if (!cache->lock) {
+		nrf_wifi_osal_mem_free(cache);
+		return NULL;
+	}
+
+	os_ops->spinlock_init(cache->lock);
+
+	cache->obj_size = obj_size;
+	cache->objs_start = (unsigned char *)(((unsigned long)(cache + 1) +
+					       NRF_WIFI_OSAL_MEM_CACHE_ALIGN - 1) &
+					      ~(NRF_WIFI_OSAL_MEM_CACHE_ALIGN - 1UL));
+	cache->objs_end = cache->objs_start + (obj_size * num_objs);
+
+	for (i = num_objs; i > 0; i--) {
+		obj = cache->objs_start + ((i - 1) * obj_size);
+		*(void **)obj = cache->free_list;
+		cache->free_list = obj;
+	}
+
+	return cache;
+}
+
+
+void nrf_wifi_osal_mem_cache_destroy(void *cache)
+{
+	struct nrf_wifi_osal_mem_cache *mem_cache = cache;
+
+	if (os_ops->mem_cache_destroy) {
+		os_ops->mem_cache_destroy(cache);
+		return;
+	}
+
+	if (!mem_cache) {
+		return;
+	}
+
+	os_ops->spinlock_free(mem_cache->lock);
+	nrf_wifi_osal_mem_free(mem_cache);
+}
+
+
+void *nrf_wifi_osal_mem_cache_alloc(void *cache)
+{
+	struct nrf_wifi_osal_mem_cache *mem_cache = cache;
+	void *obj = NULL;
+	unsigned long flags = 0;
+
+	if (os_ops->mem_cache_alloc) {
+		return os_ops->mem_cache_alloc(cache);
+	}
+
+	os_ops->spinlock_irq_take(mem_cache->lock,
+				  &flags);
+
+	obj = mem_cache->free_list;
+
+	if (obj) {
+		mem_cache->free_list = *(void **)obj;
+	}
+
+	os_ops->spinlock_irq_rel(mem_cache->lock,
+				 &flags);
+
+	if (!obj) {
+		obj = nrf_wifi_osal_mem_alloc(mem_cache->obj_size);
+	}
+
+	return obj;
+}
+
+
+void nrf_wifi_osal_mem_cache_free(void *cache,
+				  void *obj)
+{
+	struct nrf_wifi_osal_mem_cache *mem_cache = cache;
+	unsigned long flags = 0;
+
+	if (os_ops->mem_cache_free) {
+		os_ops->mem_cache_free(cache,
+				       obj);
+		return;
+	}
+
+	if (!obj) {
+		return;
+	}
+
+	if (((unsigned char *)obj < mem_cache->objs_start) ||
+	    ((unsigned char *)obj >= mem_cache->objs_end)) {
+		nrf_wifi_osal_mem_free(obj);
+		return;
+	}
+
+	os_ops->spinlock_irq_take(mem_cache->lock,
+				  &flags);
+
+	*(void **)obj = mem_cache->free_list;
+	mem_cache->free_list = obj;
+
+	os_ops->spinlock_irq_rel(mem_cache->lock,
+				 &flags);
+}
+#endif /* NRF_WIFI_OSAL_MEM_CACHE */
 
 
 void *nrf_wifi_osal_mem_cpy(void *dest,
@@ -341,12 +875,24 @@ unsigned int nrf_wifi_osal_llist_len(void *llist)
 
 void *nrf_wifi_osal_nbuf_alloc(unsigned int size)
 {
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	return nrf_wifi_osal_nbuf_alloc_tagged(size,
+					       NRF_WIFI_OSAL_MEM_TAG_OTHER);
+#else
 	return os_ops->nbuf_alloc(size);
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
 }
 
 
 void nrf_wifi_osal_nbuf_free(void *nbuf)
 {
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	unsigned long flags = 0;
+
+	mem_acct_lock_take(&flags);
+	mem_acct.num_nbuf_frees++;
+	mem_acct_lock_rel(&flags);
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
 	os_ops->nbuf_free(nbuf);
 }
 
@@ -359,6 +905,87 @@ void nrf_wifi_osal_nbuf_headroom_res(void *nbuf,
 }
 
 
+#ifdef NRF_WIFI_OSAL_NBUF_BULK
+unsigned int nrf_wifi_osal_nbuf_alloc_bulk(unsigned int size,
+					   void **nbufs,
+					   unsigned int num)
+{
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	return nrf_wifi_osal_nbuf_alloc_bulk_tagged(size,
+						    nbufs,
+						    num,
+						    NRF_WIFI_OSAL_MEM_TAG_OTHER);
+#else
+	return nbuf_alloc_bulk(size,
+			       nbufs,
+			       num);
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+}
+
+
+void nrf_wifi_osal_nbuf_free_bulk(void **nbufs,
+				  unsigned int num)
+{
+	unsigned int i = 0;
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	unsigned long flags = 0;
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
+	if (!nbufs || !num) {
+		return;
+	}
+
+#ifdef NRF_WIFI_OSAL_MEM_ACCT
+	mem_acct_lock_take(&flags);
+	mem_acct.num_nbuf_frees += num;
+	mem_acct_lock_rel(&flags);
+#endif /* NRF_WIFI_OSAL_MEM_ACCT */
+
+	if (os_ops->nbuf_free_bulk) {
+		os_ops->nbuf_free_bulk(nbufs,
+				       num);
+		return;
+	}
+
+	for (i = 0; i < num; i++) {
+		os_ops->nbuf_free(nbufs[i]);
+	}
+}
+
+
+void nrf_wifi_osal_nbuf_headroom_res_bulk(void **nbufs,
+					  unsigned int num,
+					  unsigned int size)
+{
+	unsigned int i = 0;
+
+	if (!nbufs || !num) {
+		return;
+	}
+
+	if (os_ops->nbuf_headroom_res_bulk) {
+		os_ops->nbuf_headroom_res_bulk(nbufs,
+					       num,
+					       size);
+		return;
+	}
+
+	for (i = 0; i < num; i++) {
+		os_ops->nbuf_headroom_res(nbufs[i],
+					  size);
+	}
+}
+#endif /* NRF_WIFI_OSAL_NBUF_BULK */
+
+
+#ifdef NRF70_RX_BUF_RECYCLE
+unsigned int nrf_wifi_osal_nbuf_reset(void *nbuf)
+{
+	return os_ops->nbuf_reset(nbuf);
+}
+#endif /* NRF70_RX_BUF_RECYCLE */
+
+
 unsigned int nrf_wifi_osal_nbuf_headroom_get(void *nbuf)
 {
 	return os_ops->nbuf_headroom_get(nbuf);
@@ -416,7 +1043,7 @@ void nrf_wifi_osal_nbuf_set_chksum_done(void *nbuf,
 	return os_ops->nbuf_set_chksum_done(nbuf, chksum_done);
 }
 
-#ifdef CONFIG_NRF70_RAW_DATA_TX
+#ifdef NRF70_RAW_DATA_TX
 void *nrf_wifi_osal_nbuf_set_raw_tx_hdr(void *nbuf,
 					unsigned short raw_hdr_len)
 {
@@ -433,7 +1060,7 @@ bool nrf_wifi_osal_nbuf_is_raw_tx(void *nbuf)
 {
 	return os_ops->nbuf_is_raw_tx(nbuf);
 }
-#endif /* CONFIG_NRF70_RAW_DATA_TX */
+#endif /* NRF70_RAW_DATA_TX */
 
 
 void *nrf_wifi_osal_tasklet_alloc(int type)
@@ -599,6 +1226,54 @@ void nrf_wifi_osal_bus_pcie_dev_host_map_get(void *os_pcie_dev_ctx,
 }
 
 
+#ifdef NRF_WIFI_BAL_ASYNC_XFER
+enum nrf_wifi_status nrf_wifi_osal_bus_pcie_dev_dma_xfer(void *os_pcie_dev_ctx,
+							 void *host_addr,
+							 void *dev_addr,
+							 size_t size,
+							 enum nrf_wifi_osal_dma_dir dir)
+{
+	if (!os_ops->bus_pcie_dev_dma_xfer) {
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	return os_ops->bus_pcie_dev_dma_xfer(os_pcie_dev_ctx,
+					     host_addr,
+					     dev_addr,
+					     size,
+					     dir);
+}
+
+
+enum nrf_wifi_status nrf_wifi_osal_bus_pcie_dev_dma_xfer_wait(void *os_pcie_dev_ctx)
+{
+	if (!os_ops->bus_pcie_dev_dma_xfer_wait) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	return os_ops->bus_pcie_dev_dma_xfer_wait(os_pcie_dev_ctx);
+}
+#endif /* NRF_WIFI_BAL_ASYNC_XFER */
+
+
+#ifdef NRF_WIFI_RX_ZERO_COPY
+void nrf_wifi_osal_bus_pcie_dev_dma_sync_for_cpu(void *os_pcie_dev_ctx,
+						 void *dma_addr,
+						 size_t size,
+						 enum nrf_wifi_osal_dma_dir dir)
+{
+	if (!os_ops->bus_pcie_dev_dma_sync_for_cpu) {
+		return;
+	}
+
+	os_ops->bus_pcie_dev_dma_sync_for_cpu(os_pcie_dev_ctx,
+					      dma_addr,
+					      size,
+					      dir);
+}
+#endif /* NRF_WIFI_RX_ZERO_COPY */
+
+
 void *nrf_wifi_osal_bus_qspi_init(void)
 {
 	return os_ops->bus_qspi_init();
@@ -804,7 +1479,7 @@ void nrf_wifi_osal_spi_cpy_to(void *os_spi_dev_ctx,
 				   count);
 }
 
-#ifdef NRF_WIFI_LOW_POWER
+#if defined(NRF_WIFI_LOW_POWER) || defined(NRF_WIFI_HAL_ASYNC_CMD)
 void *nrf_wifi_osal_timer_alloc(void)
 {
 	return os_ops->timer_alloc();
@@ -839,9 +1514,10 @@ void nrf_wifi_osal_timer_kill(void *timer)
 {
 	os_ops->timer_kill(timer);
 }
+#endif /* NRF_WIFI_LOW_POWER || NRF_WIFI_HAL_ASYNC_CMD */
 
 
-
+#ifdef NRF_WIFI_LOW_POWER
 int nrf_wifi_osal_bus_qspi_ps_sleep(void *os_qspi_priv)
 {
 	return os_ops->bus_qspi_ps_sleep(os_qspi_priv);
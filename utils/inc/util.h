@@ -35,4 +35,7 @@ bool nrf_wifi_utils_is_mac_addr_valid(const char *mac_addr);
 
 int nrf_wifi_utils_chan_to_freq(enum nrf_wifi_band band,
 				unsigned short chan);
+
+int nrf_wifi_utils_freq_to_chan(unsigned int freq,
+				enum nrf_wifi_band *band);
 #endif /* __UTIL_H__ */
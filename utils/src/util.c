@@ -131,3 +131,23 @@ out:
 	return freq;
 
 }
+
+
+int nrf_wifi_utils_freq_to_chan(unsigned int freq,
+				enum nrf_wifi_band *band)
+{
+	int chan = -1;
+
+	if (freq == 2484) {
+		*band = NRF_WIFI_BAND_2GHZ;
+		chan = 14;
+	} else if ((freq >= 2412) && (freq <= 2472)) {
+		*band = NRF_WIFI_BAND_2GHZ;
+		chan = ((freq - 2412) / 5) + 1;
+	} else if ((freq >= 5160) && (freq <= 5885)) {
+		*band = NRF_WIFI_BAND_5GHZ;
+		chan = (freq - 5000) / 5;
+	}
+
+	return chan;
+}